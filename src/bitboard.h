@@ -0,0 +1,188 @@
+#ifndef _BITBOARD_H
+#define _BITBOARD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define uint128_t unsigned __int128
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h>
+#define BITBOARD_SSE2
+#endif
+
+/**
+ * 128-bit board as two 64-bit lanes: squares 0..63 in the low lane and 64..80
+ * in the high one. With SSE2 both lanes live in one vector register, so the
+ * set-wise operations are single instructions and shifts never go through the
+ * multiword shld/shrd sequences of unsigned __int128.
+ */
+struct bitboard_t {
+#ifdef BITBOARD_SSE2
+  __m128i v;
+#else
+  uint64_t lo, hi;
+#endif
+};
+
+#ifdef BITBOARD_SSE2
+
+static inline struct bitboard_t bb_from_u128(uint128_t u) {
+  return (struct bitboard_t){_mm_set_epi64x(u >> 64, u)};
+}
+
+// Board with only square p set, without branching on the half.
+static inline struct bitboard_t bb_square(int p) {
+  __m128i lane = _mm_set_epi64x(p >= 64, p < 64);
+  return (struct bitboard_t){_mm_sll_epi64(lane, _mm_cvtsi32_si128(p & 63))};
+}
+
+static inline uint64_t bb_lo(struct bitboard_t b) {
+  return _mm_cvtsi128_si64(b.v);
+}
+
+static inline uint64_t bb_hi(struct bitboard_t b) {
+  return _mm_cvtsi128_si64(_mm_unpackhi_epi64(b.v, b.v));
+}
+
+static inline struct bitboard_t bb_and(struct bitboard_t a,
+                                       struct bitboard_t b) {
+  return (struct bitboard_t){_mm_and_si128(a.v, b.v)};
+}
+
+static inline struct bitboard_t bb_or(struct bitboard_t a,
+                                      struct bitboard_t b) {
+  return (struct bitboard_t){_mm_or_si128(a.v, b.v)};
+}
+
+static inline struct bitboard_t bb_xor(struct bitboard_t a,
+                                       struct bitboard_t b) {
+  return (struct bitboard_t){_mm_xor_si128(a.v, b.v)};
+}
+
+// a & ~b
+static inline struct bitboard_t bb_andnot(struct bitboard_t a,
+                                          struct bitboard_t b) {
+  return (struct bitboard_t){_mm_andnot_si128(b.v, a.v)};
+}
+
+// Shift by 0 < n < 64: each lane shifts on its own, the bits crossing lanes
+// come from the other lane moved over by a byte shift.
+static inline struct bitboard_t bb_shl(struct bitboard_t b, int n) {
+  __m128i carry = _mm_srli_epi64(_mm_slli_si128(b.v, 8), 64 - n);
+  return (struct bitboard_t){_mm_or_si128(_mm_slli_epi64(b.v, n), carry)};
+}
+
+static inline struct bitboard_t bb_shr(struct bitboard_t b, int n) {
+  __m128i carry = _mm_slli_epi64(_mm_srli_si128(b.v, 8), 64 - n);
+  return (struct bitboard_t){_mm_or_si128(_mm_srli_epi64(b.v, n), carry)};
+}
+
+#else
+
+static inline struct bitboard_t bb_from_u128(uint128_t u) {
+  return (struct bitboard_t){u, u >> 64};
+}
+
+// Board with only square p set, without branching on the half.
+static inline struct bitboard_t bb_square(int p) {
+  return (struct bitboard_t){(uint64_t)(p < 64) << (p & 63),
+                             (uint64_t)(p >= 64) << (p & 63)};
+}
+
+static inline uint64_t bb_lo(struct bitboard_t b) { return b.lo; }
+
+static inline uint64_t bb_hi(struct bitboard_t b) { return b.hi; }
+
+static inline struct bitboard_t bb_and(struct bitboard_t a,
+                                       struct bitboard_t b) {
+  return (struct bitboard_t){a.lo & b.lo, a.hi & b.hi};
+}
+
+static inline struct bitboard_t bb_or(struct bitboard_t a,
+                                      struct bitboard_t b) {
+  return (struct bitboard_t){a.lo | b.lo, a.hi | b.hi};
+}
+
+static inline struct bitboard_t bb_xor(struct bitboard_t a,
+                                       struct bitboard_t b) {
+  return (struct bitboard_t){a.lo ^ b.lo, a.hi ^ b.hi};
+}
+
+// a & ~b
+static inline struct bitboard_t bb_andnot(struct bitboard_t a,
+                                          struct bitboard_t b) {
+  return (struct bitboard_t){a.lo & ~b.lo, a.hi & ~b.hi};
+}
+
+// Shift by 0 < n < 64.
+static inline struct bitboard_t bb_shl(struct bitboard_t b, int n) {
+  return (struct bitboard_t){b.lo << n, b.hi << n | b.lo >> (64 - n)};
+}
+
+static inline struct bitboard_t bb_shr(struct bitboard_t b, int n) {
+  return (struct bitboard_t){b.lo >> n | b.hi << (64 - n), b.hi >> n};
+}
+
+#endif
+
+static inline uint128_t bb_to_u128(struct bitboard_t b) {
+  return (uint128_t)bb_hi(b) << 64 | bb_lo(b);
+}
+
+static inline bool bb_is_empty(struct bitboard_t b) {
+  return (bb_lo(b) | bb_hi(b)) == 0;
+}
+
+static inline int bb_popcount(struct bitboard_t b) {
+  return __builtin_popcountll(bb_lo(b)) + __builtin_popcountll(bb_hi(b));
+}
+
+static inline int popcount_u128(uint128_t u) {
+  return __builtin_popcountll((uint64_t)u) +
+         __builtin_popcountll((uint64_t)(u >> 64));
+}
+
+static inline bool bb_test(struct bitboard_t b, int p) {
+  return ((p < 64 ? bb_lo(b) : bb_hi(b)) >> (p & 63)) & 1;
+}
+
+// Same for an unsigned __int128, a shift of one 64-bit half instead of the
+// whole word.
+static inline bool u128_test(uint128_t u, int p) {
+  return ((p < 64 ? (uint64_t)u : (uint64_t)(u >> 64)) >> (p & 63)) & 1;
+}
+
+// Lowest set bit of a non-empty board, without branching on the half: the low
+// lane's count is used only when it is non-zero.
+static inline int bb_lsb(struct bitboard_t b) {
+  uint64_t lo = bb_lo(b), hi = bb_hi(b);
+  int low = __builtin_ctzll(lo | (uint64_t)1 << 63);
+  int high = 64 + __builtin_ctzll(hi | (uint64_t)1 << 63);
+  return lo ? low : high;
+}
+
+// Same for an unsigned __int128.
+static inline int lsb_u128(uint128_t u) {
+  uint64_t lo = u, hi = u >> 64;
+  int low = __builtin_ctzll(lo | (uint64_t)1 << 63);
+  int high = 64 + __builtin_ctzll(hi | (uint64_t)1 << 63);
+  return lo ? low : high;
+}
+
+// Iterate over the set bits of the lanes `lo` and `hi`, highest square first
+// (the order move ordering ties were tuned on), setting `i` to each square.
+// Each step is a clz and a bit clear on the active lane, the high one until
+// it runs out. A single loop, so `break` leaves it as usual.
+#define lanes_for_each_1(lo, hi, i)                                         \
+  for (uint64_t _lanes[2] = {(lo), (hi)}, _lane;                            \
+       (_lane = _lanes[1] ? 1 : 0, _lanes[_lane]) &&                        \
+       ((i) = (int)(_lane << 6) + 63 - __builtin_clzll(_lanes[_lane]), 1);  \
+       _lanes[_lane] ^= (uint64_t)1 << ((i) & 63))
+
+#define bb_for_each_1(b, i) lanes_for_each_1(bb_lo(b), bb_hi(b), i)
+
+#define u128_for_each_1(u, i) \
+  lanes_for_each_1((uint64_t)(u), (uint64_t)((u) >> 64), i)
+
+#endif
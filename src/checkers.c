@@ -5,50 +5,22 @@
 
 #include "constants.h"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HAVE_BMI2_MOVEGEN
+#define HAVE_AVX_BATCH
+#endif
+
 uint64_t _zobrist[81][3];
 uint64_t _zobrist_color;
-
-static inline int bitlen_u128(uint128_t u) {
-  if (u == 0) {
-    return 0;
-  }
-  uint64_t upper = u >> 64;
-  if (upper) {
-    return 128 - __builtin_clzll(upper);
-  } else {
-    return 64 - __builtin_clzll((uint64_t)u);
-  }
-}
-
-static inline int msb_u128(uint128_t u) {
-  if (u == 0) {
-    return -1;
-  }
-  uint64_t upper = u >> 64;
-  if (upper) {
-    return 127 - __builtin_clzll(upper);
-  } else {
-    return 63 - __builtin_clzll((uint64_t)u);
-  }
-}
-
-static inline int lsb_u128(uint128_t u) {
-  if (u == 0) {
-    return -1;
-  }
-  uint64_t lower = u;
-  uint64_t upper = u >> 64;
-  if (lower) {
-    return __builtin_ctzll(lower);
-  } else {
-    return 64 + __builtin_ctzll(upper);
-  }
-}
-
-// Iterate over each set bit (1) in a 128-bit unsigned integer `u`,
-// updating `i` with the index of the highest set bit in each iteration.
-#define u128_for_each_1(u, i) \
-  for (; i = bitlen_u128(u) - 1, u; u ^= ((uint128_t)1 << i))
+// _zobrist of the square and colour a piece maps to under each symmetry
+uint64_t _sym_zobrist[4][81][2];
+// _binomial[k][n] = C(n, k), the place values of game_pack's army ranks. Rows
+// are padded with UINT64_MAX up to 128 for the unranking search.
+uint64_t _binomial[ARMY_SIZE + 1][128];
+// _unrank_start[k][rank_key(r)] = largest n with C(n, k) <= r for the
+// smallest r of that key. Within a key the answer spans at most 8 entries.
+uint8_t _unrank_start[ARMY_SIZE + 1][312];
 
 // 1(-1) 2(-1) 9(-7) 11(-8) 18(-14) 19(-14)
 #define hash_adj(p, adj)                                                       \
@@ -63,6 +35,25 @@ static inline int lsb_u128(uint128_t u) {
              (((adj << (10 - p)) & 0x40000) >> 14) |                           \
              (((adj << (10 - p)) & 0x80000) >> 14)))
 
+// Landing squares of the jumps over the occupied neighbours `index` (as packed
+// by hash_adj) of square p: the jumps that stay on the board, spread out from
+// a window starting at p - 20.
+#define jump_landings(p, index) \
+  (((uint128_t)JUMP_LANDINGS[(index) & JUMP_DIRECTIONS[p]] << (p)) >> 20)
+
+// Bits of the six neighbours of square p in a window starting at p - 10, in the
+// order hash_adj packs them.
+#define ADJ_WINDOW_BITS 0xc0a06
+
+// Squares in columns 0-6 and 2-8, the sources of jumps two columns to the
+// right and left respectively.
+#define COLS_0_6 (((uint128_t)0x7f3f << 64) | 0x9fcfe7f3f9fcfe7f)
+#define COLS_2_8 (((uint128_t)0x1fcfe << 64) | 0x7f3f9fcfe7f3f9fc)
+
+// Squares in columns 0-7 and 1-8, the sources of steps to the right and left.
+#define COLS_0_7 (((uint128_t)0xff7f << 64) | 0xbfdfeff7fbfdfeff)
+#define COLS_1_8 (((uint128_t)0x1feff << 64) | 0x7fbfdfeff7fbfdfe)
+
 const int BOARD_DISTANCES[81] = {
     0, 1, 2,  3,  4,  5,  6,  7,  8,   // 0
     1, 2, 3,  4,  5,  6,  7,  8,  9,   // 1
@@ -92,13 +83,60 @@ uint64_t rand64() {
          ((uint64_t)rand() << 45) ^ ((uint64_t)rand() << 60);
 }
 
+// A rank's bit length and the 3 bits below its top one, 0..311 for ranks below
+// 2^41. Ranks of one key are within a factor 9/8 of each other.
+static inline int rank_key(uint64_t rank) {
+  int len = 64 - __builtin_clzll(rank | 1);
+  return rank < 16 ? (int)rank : (len - 4) * 8 + (int)(rank >> (len - 4));
+}
+
+static void init_binomials() {
+  for (int k = 0; k <= ARMY_SIZE; k++) {
+    for (int n = 0; n < 128; n++) {
+      if (n > 81) {
+        _binomial[k][n] = UINT64_MAX;
+      } else if (k == 0) {
+        _binomial[k][n] = 1;
+      } else {
+        _binomial[k][n] =
+            n == 0 ? 0 : _binomial[k - 1][n - 1] + _binomial[k][n - 1];
+      }
+    }
+    for (int key = 0; key < 312; key++) {
+      uint64_t rank = key < 16 ? key : (uint64_t)(key % 8 + 8) << (key / 8 - 1);
+      int n = 0;
+      while (n < 81 && _binomial[k][n + 1] <= rank) {
+        n++;
+      }
+      _unrank_start[k][key] = n;
+    }
+  }
+}
+
 void init_zobrist() {
+  init_binomials();
   _zobrist_color = rand64();
   for (int i = 0; i < 81; i++) {
     _zobrist[i][0] = rand64();
     _zobrist[i][1] = rand64();
     _zobrist[i][2] = rand64();
   }
+  for (int sym = 0; sym < 4; sym++) {
+    for (int p = 0; p < 81; p++) {
+      for (int color = PIECE_RED; color <= PIECE_GREEN; color++) {
+        _sym_zobrist[sym][p][color] =
+            _zobrist[symmetric_square(sym, p)]
+                    [sym & SYM_FLIP ? opponent(color) : color];
+      }
+    }
+  }
+}
+
+int symmetric_square(int sym, int p) {
+  if (sym & SYM_TRANSPOSE) {
+    p = p % 9 * 9 + p / 9;
+  }
+  return sym & SYM_FLIP ? 80 - p : p;
 }
 
 uint64_t game_hash(struct game_t *game) {
@@ -112,113 +150,637 @@ uint64_t game_hash(struct game_t *game) {
     hash ^= _zobrist_color;
   }
   game->hash = hash;
+  for (int sym = 1; game->symmetric && sym < 4; sym++) {
+    uint64_t sym_hash = 0;
+    red = game->board.red;
+    green = game->board.green;
+    u128_for_each_1(red, p) { sym_hash ^= _sym_zobrist[sym][p][PIECE_RED]; }
+    u128_for_each_1(green, p) {
+      sym_hash ^= _sym_zobrist[sym][p][PIECE_GREEN];
+    }
+    if ((sym & SYM_FLIP ? opponent(game->turn) : game->turn) == PIECE_GREEN) {
+      sym_hash ^= _zobrist_color;
+    }
+    game->sym_hash[sym - 1] = sym_hash;
+  }
   return hash;
 }
 
-int gen_moves(struct board_t *board, uint128_t from, struct list_head *moves) {
-  int len = 0;
-  int src, dst;
+void game_set_symmetric(struct game_t *game, bool symmetric) {
+  game->symmetric = symmetric;
+  game_hash(game);
+}
+
+uint64_t game_canonical_hash(struct game_t *game, int *sym) {
+  uint64_t hash = game->hash;
+  *sym = 0;
+  for (int i = 1; game->symmetric && i < 4; i++) {
+    if (game->sym_hash[i - 1] < hash) {
+      hash = game->sym_hash[i - 1];
+      *sym = i;
+    }
+  }
+  return hash;
+}
+
+// The mirrored keys follow a move of `color` from src to dst, and the turn.
+static inline void sym_hash_move(struct game_t *game, int src, int dst,
+                                 enum color_t color) {
+  for (int sym = 1; sym < 4; sym++) {
+    game->sym_hash[sym - 1] ^= _sym_zobrist[sym][src][color] ^
+                               _sym_zobrist[sym][dst][color] ^ _zobrist_color;
+  }
+}
+
+#define MOVEGEN(name) name##_generic
+#define MOVEGEN_TARGET
+#define JUMP_INDEX(p, adj) hash_adj(p, adj)
+#include "movegen_impl.h"
+#undef MOVEGEN
+#undef MOVEGEN_TARGET
+#undef JUMP_INDEX
+
+#ifdef HAVE_BMI2_MOVEGEN
+// Same index as hash_adj with a single PEXT: shift the neighbours into a window
+// starting at p - 10 (branch-free, the board leaves room for the 10 bit shift)
+// and gather the six neighbour bits.
+#define MOVEGEN(name) name##_bmi2
+#define MOVEGEN_TARGET __attribute__((target("bmi2")))
+#define JUMP_INDEX(p, adj) \
+  _pext_u64((uint64_t)(((adj) << 10) >> (p)), ADJ_WINDOW_BITS)
+#include "movegen_impl.h"
+#undef MOVEGEN
+#undef MOVEGEN_TARGET
+#undef JUMP_INDEX
+#endif
+
+// Landing squares of single jumps from every square in `from` at once. A jump
+// in direction d is legal if the neighbour is occupied and the landing square
+// is empty; the column masks keep jumps from wrapping around a row.
+#define jump_dir(shift, from, all, n) shift(bb_and(shift(from, n), all), n)
+
+static inline struct bitboard_t jump_step(struct bitboard_t from,
+                                          struct bitboard_t all) {
+  struct bitboard_t right = bb_and(from, bb_from_u128(COLS_0_6));
+  struct bitboard_t left = bb_and(from, bb_from_u128(COLS_2_8));
+  struct bitboard_t to = bb_or(jump_dir(bb_shl, right, all, 1),
+                               jump_dir(bb_shr, left, all, 1));
+  to = bb_or(to, bb_or(jump_dir(bb_shl, from, all, 9),
+                       jump_dir(bb_shr, from, all, 9)));
+  to = bb_or(to, bb_or(jump_dir(bb_shl, left, all, 8),
+                       jump_dir(bb_shr, right, all, 8)));
+  return bb_andnot(bb_and(to, bb_from_u128(BOARD_MASK)), all);
+}
+
+// All squares reachable from `from` by one or more jumps, advancing the whole
+// frontier one hop per iteration.
+static inline struct bitboard_t jump_closure(struct bitboard_t from,
+                                             struct bitboard_t all) {
+  struct bitboard_t reach = from, frontier = from;
+  while (!bb_is_empty(frontier)) {
+    frontier = bb_andnot(jump_step(frontier, all), reach);
+    reach = bb_or(reach, frontier);
+  }
+  return bb_andnot(reach, from);
+}
+
+static void gen_dests_setwise(struct board_t *board, uint128_t from,
+                              uint128_t *dests) {
+  int src;
+  uint128_t all = board->red | board->green;
+  struct bitboard_t all_bb = bb_from_u128(all);
+  u128_for_each_1(from, src) {
+    dests[src] = (ADJ_POSITIONS[src] & ~all & BOARD_MASK) |
+                 bb_to_u128(jump_closure(bb_square(src), all_bb));
+  }
+}
+
+static void jump_moves_setwise(struct board_t *board, int src, uint128_t *to) {
+  struct bitboard_t all = bb_from_u128(board->red | board->green);
+  *to |= bb_to_u128(jump_closure(bb_square(src), all));
+}
+
+static bool game_is_move_valid_setwise(struct game_t *game,
+                                       struct move_t *move) {
+  uint128_t all = game->board.red | game->board.green;
+  if (u128_test(all, move->dst) || !u128_test(all, move->src)) {
+    return false;
+  }
+  if (u128_test(game->board.pieces[opponent(game->turn)], move->src)) {
+    return false;
+  }
+  // check for adjacent moves
+  if (u128_test(ADJ_POSITIONS[move->src], move->dst)) {
+    return true;
+  }
+  // check for jumps, one hop of the whole frontier at a time
+  struct bitboard_t all_bb = bb_from_u128(all);
+  struct bitboard_t reach = bb_square(move->src), frontier = reach;
+  while (!bb_is_empty(frontier)) {
+    frontier = bb_andnot(jump_step(frontier, all_bb), reach);
+    if (bb_test(frontier, move->dst)) {
+      return true;
+    }
+    reach = bb_or(reach, frontier);
+  }
+  return false;
+}
+
+// Like gen_dests_setwise, but shares jump closures between pieces. Jumps are
+// symmetric, so the squares reachable by jumping form connected components of
+// empty squares; a piece reaches exactly the components of its first-hop
+// landings. Each component is flooded once per position, on first use.
+static void gen_dests_components(struct board_t *board, uint128_t from,
+                                 uint128_t *dests) {
+  int src, n = 0;
   uint128_t all = board->red | board->green;
+  struct bitboard_t all_bb = bb_from_u128(all);
+  struct bitboard_t components[81], flooded = bb_from_u128(0);
+  // Empty squares with a jump to another empty square; the rest are
+  // components of their own and need no flood.
+  struct bitboard_t linked =
+      jump_step(bb_from_u128(~all & BOARD_MASK), all_bb);
   u128_for_each_1(from, src) {
-    uint128_t to = 0;
-    uint128_t adj = ADJ_POSITIONS[src];
-    to |= adj;
-    to &= ~all & BOARD_MASK;
-
-    uint128_t jump_to = 0, prev_jump_to = MASK_AT(src), jumps;
-    while ((prev_jump_to | jump_to) != jump_to) {
-      jump_to |= prev_jump_to;
-      jumps = 0;
-      u128_for_each_1(prev_jump_to, dst) {
-        adj = ADJ_POSITIONS[dst] & all;
-        jumps |= JUMP_POSITIONS[dst][hash_adj(dst, adj)] & BOARD_MASK;
+    struct bitboard_t to = bb_from_u128(ADJ_POSITIONS[src] & ~all & BOARD_MASK);
+    struct bitboard_t landings = jump_step(bb_square(src), all_bb);
+    to = bb_or(to, bb_andnot(landings, linked));
+    landings = bb_and(landings, linked);
+    for (int i = 0; i < n && !bb_is_empty(bb_and(landings, flooded)); i++) {
+      if (!bb_is_empty(bb_and(components[i], landings))) {
+        to = bb_or(to, components[i]);
+        landings = bb_andnot(landings, components[i]);
       }
-      prev_jump_to = jumps & ~all;
     }
-    jump_to &= ~MASK_AT(src);
-    to |= jump_to;
+    while (!bb_is_empty(landings)) {
+      struct bitboard_t p = bb_square(bb_lsb(landings));
+      components[n] = bb_or(p, jump_closure(p, all_bb));
+      flooded = bb_or(flooded, components[n]);
+      to = bb_or(to, components[n]);
+      landings = bb_andnot(landings, components[n]);
+      n++;
+    }
+    dests[src] = bb_to_u128(to);
+  }
+}
+
+// Per square and direction: the square jumping over it and that jump's
+// landing, and the square jumping onto it and the square it jumps over. -1
+// where a jump would leave the board. Filled by init_movegen().
+static int8_t _jumps_over[81][6][2];
+static int8_t _jumps_onto[81][6][2];
 
+static void init_jump_neighbours() {
+  static const int8_t directions[6][2] = {{-1, 0}, {-1, 1}, {0, -1},
+                                          {0, 1},  {1, -1}, {1, 0}};
+  for (int p = 0; p < 81; p++) {
+    int r = p / 9, c = p % 9;
+    for (int d = 0; d < 6; d++) {
+      int dr = directions[d][0], dc = directions[d][1];
+      bool over = (unsigned)(r - dr) < 9 && (unsigned)(c - dc) < 9 &&
+                  (unsigned)(r + dr) < 9 && (unsigned)(c + dc) < 9;
+      bool onto = (unsigned)(r - 2 * dr) < 9 && (unsigned)(c - 2 * dc) < 9;
+      _jumps_over[p][d][0] = over ? p - 9 * dr - dc : -1;
+      _jumps_over[p][d][1] = over ? p + 9 * dr + dc : -1;
+      _jumps_onto[p][d][0] = onto ? p - 18 * dr - 2 * dc : -1;
+      _jumps_onto[p][d][1] = onto ? p - 9 * dr - dc : -1;
+    }
+  }
+}
+
+// Update the jumps over and onto square p, which just became `occupied`.
+static inline void jump_graph_flip(struct jump_graph_t *graph, uint128_t all,
+                                   int p, bool occupied) {
+  for (int d = 0; d < 6; d++) {
+    int from = _jumps_over[p][d][0], to = _jumps_over[p][d][1];
+    if (from >= 0) {
+      if (occupied && !(all >> to & 1)) {
+        graph->jumps[from] |= MASK_AT(to);
+      } else {
+        graph->jumps[from] &= ~MASK_AT(to);
+      }
+    }
+    from = _jumps_onto[p][d][0];
+    int over = _jumps_onto[p][d][1];
+    if (from >= 0) {
+      if (!occupied && all >> over & 1) {
+        graph->jumps[from] |= MASK_AT(p);
+      } else {
+        graph->jumps[from] &= ~MASK_AT(p);
+      }
+    }
+  }
+}
+
+// Move a piece from `src` to `dst` in the graph of a board that already
+// reflects the move.
+static inline void jump_graph_move(struct jump_graph_t *graph,
+                                   struct board_t *board, int src, int dst) {
+  uint128_t all = board->red | board->green;
+  jump_graph_flip(graph, all & ~MASK_AT(dst), src, false);
+  jump_graph_flip(graph, all, dst, true);
+}
+
+void game_attach_jump_graph(struct game_t *game, struct jump_graph_t *graph) {
+  game->graph = graph;
+  if (graph == NULL) {
+    return;
+  }
+  uint128_t all = game->board.red | game->board.green;
+  uint128_t adj;
+  for (int p = 0; p < 81; p++) {
+    adj = ADJ_POSITIONS[p] & all;
+    graph->jumps[p] = jump_landings(p, hash_adj(p, adj)) & ~all & BOARD_MASK;
+  }
+}
+
+static inline uint128_t graph_jump_closure(struct jump_graph_t *graph,
+                                           uint128_t from) {
+  uint128_t reach = from, frontier = from, jumps;
+  int p;
+  while (frontier) {
+    jumps = 0;
+    u128_for_each_1(frontier, p) { jumps |= graph->jumps[p]; }
+    frontier = jumps & ~reach;
+    reach |= frontier;
+  }
+  return reach & ~from;
+}
+
+// Squares closer to the opponent's corner than a given square, for either
+// colour. Filled by init_movegen().
+static uint128_t _forward_masks[2][81];
+
+int SIDE_DISTANCES[2][81];
+int SIDE_SCORES[2][81];
+
+static void init_side_tables() {
+  for (int p = 0; p < 81; p++) {
+    SIDE_DISTANCES[PIECE_RED][p] = BOARD_DISTANCES[p];
+    SIDE_DISTANCES[PIECE_GREEN][p] = -BOARD_DISTANCES[p];
+    SIDE_SCORES[PIECE_RED][p] = SCORE_TABLE[80 - p];
+    SIDE_SCORES[PIECE_GREEN][p] = SCORE_TABLE[p];
+  }
+  for (int src = 0; src < 81; src++) {
+    _forward_masks[PIECE_RED][src] = 0;
+    _forward_masks[PIECE_GREEN][src] = 0;
+    for (int dst = 0; dst < 81; dst++) {
+      if (BOARD_DISTANCES[dst] < BOARD_DISTANCES[src]) {
+        _forward_masks[PIECE_RED][src] |= MASK_AT(dst);
+      } else if (BOARD_DISTANCES[dst] > BOARD_DISTANCES[src]) {
+        _forward_masks[PIECE_GREEN][src] |= MASK_AT(dst);
+      }
+    }
+  }
+}
+
+void game_gen_dests(struct game_t *game, uint128_t from, uint128_t *dests) {
+  if (game->graph == NULL) {
+    gen_dests(&game->board, from, dests);
+    return;
+  }
+  int src;
+  uint128_t all = game->board.red | game->board.green;
+  u128_for_each_1(from, src) {
+    dests[src] = (ADJ_POSITIONS[src] & ~all & BOARD_MASK) |
+                 graph_jump_closure(game->graph, MASK_AT(src));
+  }
+}
+
+static inline int emit_moves(uint128_t from, uint128_t *dests,
+                             struct move_list_t *moves) {
+  int len = moves->len;
+  int src, dst;
+  u128_for_each_1(from, src) {
+    uint128_t to = dests[src];
     u128_for_each_1(to, dst) {
-      struct move_t *m = (struct move_t *)malloc(sizeof(struct move_t));
-      m->src = src;
-      m->dst = dst;
-      list_add_tail(&m->list, moves);
-      len++;
+      moves->moves[len++] = (struct move_t){.src = src, .dst = dst};
     }
   }
+  len -= moves->len;
+  moves->len += len;
   return len;
 }
 
-void jump_moves(struct board_t *board, int src, uint128_t *to) {
-  uint128_t adj = ADJ_POSITIONS[src] & (board->red | board->green);
-  uint128_t jumps = JUMP_POSITIONS[src][hash_adj(src, adj)] & BOARD_MASK;
-  jumps &= ~(board->red | board->green);
-  if ((jumps | *to) == *to) {
-    // no more jumps
+int game_gen_moves(struct game_t *game, uint128_t from,
+                   struct move_list_t *moves) {
+  uint128_t dests[81];
+  game_gen_dests(game, from, dests);
+  return emit_moves(from, dests, moves);
+}
+
+int count_forward_moves(struct game_t *game, enum color_t color) {
+  uint128_t dests[81];
+  uint128_t from = game->board.pieces[color];
+  int src, count = 0;
+  game_gen_dests(game, from, dests);
+  u128_for_each_1(from, src) {
+    count += popcount_u128(dests[src] & _forward_masks[color][src]);
+  }
+  return count;
+}
+
+#define BATCH(name) name##_generic
+#define BATCH_TARGET
+#define BATCH_LANES 2
+#define BATCH_ANY(v) (((v)[0] | (v)[1]) != 0)
+#include "movegen_batch_impl.h"
+#undef BATCH
+#undef BATCH_TARGET
+#undef BATCH_LANES
+#undef BATCH_ANY
+
+#ifdef HAVE_AVX_BATCH
+#define BATCH(name) name##_avx2
+#define BATCH_TARGET __attribute__((target("avx2")))
+#define BATCH_LANES 4
+#define BATCH_ANY(v) (!_mm256_testz_si256((__m256i)(v), (__m256i)(v)))
+#include "movegen_batch_impl.h"
+#undef BATCH
+#undef BATCH_TARGET
+#undef BATCH_LANES
+#undef BATCH_ANY
+
+#define BATCH(name) name##_avx512
+#define BATCH_TARGET __attribute__((target("avx512f")))
+#define BATCH_LANES 8
+#define BATCH_ANY(v) (_mm512_test_epi64_mask((__m512i)(v), (__m512i)(v)) != 0)
+#include "movegen_batch_impl.h"
+#undef BATCH
+#undef BATCH_TARGET
+#undef BATCH_LANES
+#undef BATCH_ANY
+#endif
+
+static void (*_gen_dests)(struct board_t *, uint128_t,
+                          uint128_t *) = gen_dests_generic;
+static void (*_jump_moves)(struct board_t *, int,
+                           uint128_t *) = jump_moves_generic;
+static bool (*_game_is_move_valid)(struct game_t *,
+                                   struct move_t *) = game_is_move_valid_generic;
+
+bool set_movegen_impl(enum movegen_impl_t impl) {
+  switch (impl) {
+    case MOVEGEN_GENERIC:
+      _gen_dests = gen_dests_generic;
+      _jump_moves = jump_moves_generic;
+      _game_is_move_valid = game_is_move_valid_generic;
+      return true;
+    case MOVEGEN_BMI2:
+#ifdef HAVE_BMI2_MOVEGEN
+      if (!__builtin_cpu_supports("bmi2")) {
+        return false;
+      }
+      _gen_dests = gen_dests_bmi2;
+      _jump_moves = jump_moves_bmi2;
+      _game_is_move_valid = game_is_move_valid_bmi2;
+      return true;
+#else
+      return false;
+#endif
+    case MOVEGEN_SETWISE:
+      _gen_dests = gen_dests_setwise;
+      _jump_moves = jump_moves_setwise;
+      _game_is_move_valid = game_is_move_valid_setwise;
+      return true;
+    case MOVEGEN_COMPONENTS:
+      _gen_dests = gen_dests_components;
+      _jump_moves = jump_moves_setwise;
+      _game_is_move_valid = game_is_move_valid_setwise;
+      return true;
+  }
+  return false;
+}
+
+static void (*_gen_dests_batch)(struct board_batch_t *, int,
+                                uint128_t (*)[81]) = gen_dests_batch_generic;
+static int _batch_lanes = 2;
+
+bool set_batch_impl(enum batch_impl_t impl) {
+  switch (impl) {
+    case BATCH_GENERIC:
+      _gen_dests_batch = gen_dests_batch_generic;
+      _batch_lanes = 2;
+      return true;
+    case BATCH_AVX2:
+#ifdef HAVE_AVX_BATCH
+      if (!__builtin_cpu_supports("avx2")) {
+        return false;
+      }
+      _gen_dests_batch = gen_dests_batch_avx2;
+      _batch_lanes = 4;
+      return true;
+#else
+      return false;
+#endif
+    case BATCH_AVX512:
+#ifdef HAVE_AVX_BATCH
+      if (!__builtin_cpu_supports("avx512f")) {
+        return false;
+      }
+      _gen_dests_batch = gen_dests_batch_avx512;
+      _batch_lanes = 8;
+      return true;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+void init_movegen() {
+  init_jump_neighbours();
+  init_side_tables();
+  if (!set_batch_impl(BATCH_AVX512) && !set_batch_impl(BATCH_AVX2)) {
+    set_batch_impl(BATCH_GENERIC);
+  }
+#ifdef DEFAULT_MOVEGEN
+  if (set_movegen_impl(DEFAULT_MOVEGEN)) {
     return;
   }
-  *to |= jumps;
-  u128_for_each_1(jumps, src) { jump_moves(board, src, to); }
-  return;
+#endif
+  if (!set_movegen_impl(MOVEGEN_BMI2)) {
+    set_movegen_impl(MOVEGEN_GENERIC);
+  }
 }
 
-bool game_is_move_valid(struct game_t *game, struct move_t *move) {
+void gen_dests(struct board_t *board, uint128_t from, uint128_t *dests) {
+  _gen_dests(board, from, dests);
+}
+
+int gen_moves(struct board_t *board, uint128_t from, struct move_list_t *moves) {
+  uint128_t dests[81];
+  _gen_dests(board, from, dests);
+  return emit_moves(from, dests, moves);
+}
+
+bool batch_add_board(struct board_batch_t *batch, struct board_t *board,
+                     enum color_t turn) {
+  if (batch->len == BATCH_SIZE) {
+    return false;
+  }
+  batch->red[0][batch->len] = board->red;
+  batch->red[1][batch->len] = board->red >> 64;
+  batch->green[0][batch->len] = board->green;
+  batch->green[1][batch->len] = board->green >> 64;
+  batch->turn[batch->len] = turn;
+  batch->len++;
+  return true;
+}
+
+int gen_moves_batch(struct board_batch_t *batch, struct move_list_t *moves) {
+  uint128_t dests[BATCH_SIZE][81];
+  int len = 0;
+  // empty boards in the unused lanes have no pieces to move
+  for (int i = batch->len; i < BATCH_SIZE; i++) {
+    batch->red[0][i] = batch->red[1][i] = 0;
+    batch->green[0][i] = batch->green[1][i] = 0;
+    batch->turn[i] = PIECE_RED;
+  }
+  for (int i = 0; i < batch->len; i += _batch_lanes) {
+    _gen_dests_batch(batch, i, dests);
+  }
+  for (int i = 0; i < batch->len; i++) {
+    uint64_t(*own)[BATCH_SIZE] =
+        batch->turn[i] == PIECE_RED ? batch->red : batch->green;
+    uint128_t from = (uint128_t)own[1][i] << 64 | own[0][i];
+    len += emit_moves(from, dests[i], &moves[i]);
+  }
+  return len;
+}
+
+void jump_moves(struct board_t *board, int src, uint128_t *to) {
+  _jump_moves(board, src, to);
+}
+
+// Follow the hops of a move with a path: each hop needs an occupied middle
+// square and an empty landing. `src` stays occupied, as in the flood fills.
+static bool game_is_path_valid(struct game_t *game, struct move_t *move) {
   uint128_t all = game->board.red | game->board.green;
-  int to;
-  if (all >> move->dst & 1 || !(all >> move->src & 1)) {
+  int p = move->src;
+  if (!(game->board.pieces[game->turn] >> p & 1)) {
     return false;
   }
-  if (MASK_AT(move->src) &
-      (game->turn == PIECE_RED ? game->board.green : game->board.red)) {
+  for (int i = 0; i < move->hops; i++) {
+    // the hop from p in direction d is the jump onto p in the opposite one
+    int8_t *hop = _jumps_onto[p][5 - (move->path >> (3 * i) & 7)];
+    if (hop[0] < 0 || !(all >> hop[1] & 1) || all >> hop[0] & 1) {
+      return false;
+    }
+    p = hop[0];
+  }
+  return p == move->dst;
+}
+
+bool game_is_move_valid(struct game_t *game, struct move_t *move) {
+  if (move->hops) {
+    return game_is_path_valid(game, move);
+  }
+  return _game_is_move_valid(game, move);
+}
+
+void game_fill_reach(struct game_t *game, struct reach_cache_t *cache,
+                     uint128_t from) {
+  from &= ~cache->known;
+  if (from) {
+    game_gen_dests(game, from, cache->dests);
+    cache->known |= from;
+  }
+}
+
+bool game_is_move_reachable(struct game_t *game, struct reach_cache_t *cache,
+                            struct move_t *move) {
+  if (move->hops) {
+    return game_is_path_valid(game, move);
+  }
+  if (!(game->board.pieces[game->turn] >> move->src & 1)) {
     return false;
   }
-  // check for adjacent moves
-  if (ADJ_POSITIONS[move->src] & MASK_AT(move->dst)) {
+  game_fill_reach(game, cache, MASK_AT(move->src));
+  return cache->dests[move->src] >> move->dst & 1;
+}
+
+bool game_find_move_path(struct game_t *game, struct move_t *move) {
+  struct bitboard_t layers[MAX_PATH_HOPS + 1], reach, all;
+  int n, p = move->dst;
+  move->hops = 0;
+  move->path = 0;
+  if (!_game_is_move_valid(game, move)) {
+    return false;
+  }
+  if (ADJ_POSITIONS[move->src] >> move->dst & 1) {
     return true;
   }
-  // check for jumps
-  uint128_t jump_to = 0, prev_jump_to = MASK_AT(move->src), jumps = 0;
-  uint128_t adj;
-  while ((prev_jump_to | jump_to) != jump_to) {
-    jump_to |= prev_jump_to;
-    jumps = 0;
-    u128_for_each_1(prev_jump_to, to) {
-      adj = ADJ_POSITIONS[to] & all;
-      jumps |= JUMP_POSITIONS[to][hash_adj(to, adj)] & BOARD_MASK;
-      if (jumps & MASK_AT(move->dst)) {
-        return true;
+  // breadth-first, one layer of landings per hop
+  all = bb_from_u128(game->board.red | game->board.green);
+  layers[0] = reach = bb_square(move->src);
+  for (n = 1; n <= MAX_PATH_HOPS; n++) {
+    layers[n] = bb_andnot(jump_step(layers[n - 1], all), reach);
+    if (bb_test(layers[n], move->dst)) {
+      break;
+    }
+    reach = bb_or(reach, layers[n]);
+  }
+  if (n > MAX_PATH_HOPS) {
+    return true;
+  }
+  // walk back from dst through the layers
+  for (int i = n - 1; i >= 0; i--) {
+    for (int d = 0; d < 6; d++) {
+      int8_t *from = _jumps_onto[p][d];
+      if (from[0] >= 0 && bb_test(layers[i], from[0]) &&
+          bb_test(all, from[1])) {
+        move->path |= (uint32_t)d << (3 * i);
+        p = from[0];
+        break;
       }
     }
-    prev_jump_to = jumps & ~all;
   }
-  return false;
+  move->hops = n;
+  return true;
+}
+
+int move_squares(struct move_t *move, int8_t *squares) {
+  int p = move->src;
+  squares[0] = p;
+  if (!move->hops) {
+    squares[1] = move->dst;
+    return 2;
+  }
+  for (int i = 0; i < move->hops; i++) {
+    p = _jumps_onto[p][5 - (move->path >> (3 * i) & 7)][0];
+    squares[i + 1] = p;
+  }
+  return move->hops + 1;
 }
 
-void sort_moves(struct list_head *moves, enum color_t color) {
-  struct list_head buckets[64];
-  for (int i = 0; i < 64; i++) {
-    INIT_LIST_HEAD(&buckets[i]);
+void move_str(struct move_t *move, char *str) {
+  int8_t squares[MAX_PATH_HOPS + 1];
+  int n = move_squares(move, squares);
+  for (int i = 0; i < n; i++) {
+    str += sprintf(str, i ? "-%02d" : "%02d", squares[i]);
   }
+}
 
-  struct list_head *pos, *_n;
+void sort_moves(struct move_list_t *moves, enum color_t color) {
+  // Stable counting sort on the distance travelled, offset by 16 to handle
+  // negative distances.
+  int counts[33] = {0};
+  struct move_t sorted[MAX_MOVES];
   struct move_t *move;
-  list_for_each_safe(pos, _n, moves) {
-    move = list_entry(pos, struct move_t, list);
-    list_del(pos);
-    int distance = BOARD_DISTANCES[move->dst] - BOARD_DISTANCES[move->src];
-    list_add_tail(
-        pos,
-        &buckets[distance + 16]);  // Offset by 16 to handle negative distances
-  }
-
-  if (color == PIECE_RED) {
-    for (int i = 0; i < 64; i++) {
-      list_splice_tail(&buckets[i], moves);
-    }
-  } else {
-    for (int i = 63; i >= 0; i--) {
-      list_splice_tail(&buckets[i], moves);
-    }
+  for (int i = 0; i < moves->len; i++) {
+    move = &moves->moves[i];
+    counts[16 - forward_distance(color, move->src, move->dst)]++;
+  }
+  for (int i = 1; i < 33; i++) {
+    counts[i] += counts[i - 1];
+  }
+  for (int i = moves->len - 1; i >= 0; i--) {
+    move = &moves->moves[i];
+    sorted[--counts[16 - forward_distance(color, move->src, move->dst)]] =
+        *move;
+  }
+  for (int i = 0; i < moves->len; i++) {
+    moves->moves[i] = sorted[i];
   }
 }
 
@@ -228,54 +790,98 @@ void game_apply_move(struct game_t *game, struct move_t *move) {
     game->hash ^= _zobrist[move->dst][game->turn];
     game->hash ^= _zobrist_color;
   }
-  if (game->turn == PIECE_RED) {
-    game->board.red &= ~MASK_AT(move->src);
-    game->board.red |= MASK_AT(move->dst);
-    game->turn = PIECE_GREEN;
-  } else {
-    game->board.green &= ~MASK_AT(move->src);
-    game->board.green |= MASK_AT(move->dst);
-    game->turn = PIECE_RED;
-    game->round++;
+  if (game->symmetric) {
+    sym_hash_move(game, move->src, move->dst, game->turn);
+  }
+  // src is the mover's and dst is empty, so one xor moves the piece; green's
+  // move completes the round
+  game->board.pieces[game->turn] ^= MASK_AT(move->src) | MASK_AT(move->dst);
+  game->round += game->turn;
+  game->turn = opponent(game->turn);
+  if (game->graph != NULL) {
+    jump_graph_move(game->graph, &game->board, move->src, move->dst);
   }
 }
 
 void game_undo_move(struct game_t *game, struct move_t *move) {
-  if (game->turn == PIECE_GREEN) {
-    game->board.red &= ~MASK_AT(move->dst);
-    game->board.red |= MASK_AT(move->src);
-    game->turn = PIECE_RED;
-  } else {
-    game->board.green &= ~MASK_AT(move->dst);
-    game->board.green |= MASK_AT(move->src);
-    game->turn = PIECE_GREEN;
-    game->round--;
+  game->turn = opponent(game->turn);
+  game->round -= game->turn;
+  game->board.pieces[game->turn] ^= MASK_AT(move->src) | MASK_AT(move->dst);
+  if (game->graph != NULL) {
+    jump_graph_move(game->graph, &game->board, move->dst, move->src);
   }
   if (game->hash != 0) {
     game->hash ^= _zobrist[move->src][game->turn];
     game->hash ^= _zobrist[move->dst][game->turn];
     game->hash ^= _zobrist_color;
   }
+  if (game->symmetric) {
+    sym_hash_move(game, move->src, move->dst, game->turn);
+  }
 }
 
-void game_apply_null_move(struct game_t *game) {
+// The side to move is part of every key, mirrored or not.
+static inline void toggle_turn_hashes(struct game_t *game) {
   if (game->hash != 0) {
     game->hash ^= _zobrist_color;
   }
-  game->turn = game->turn == PIECE_RED ? PIECE_GREEN : PIECE_RED;
-  if (game->turn == PIECE_RED) {
-    game->round++;
+  if (game->symmetric) {
+    game->sym_hash[0] ^= _zobrist_color;
+    game->sym_hash[1] ^= _zobrist_color;
+    game->sym_hash[2] ^= _zobrist_color;
   }
 }
 
+void game_apply_null_move(struct game_t *game) {
+  toggle_turn_hashes(game);
+  game->round += game->turn;
+  game->turn = opponent(game->turn);
+}
+
 void game_undo_null_move(struct game_t *game) {
-  game->turn = game->turn == PIECE_RED ? PIECE_GREEN : PIECE_RED;
-  if (game->turn == PIECE_GREEN) {
-    game->round--;
+  game->turn = opponent(game->turn);
+  game->round -= game->turn;
+  toggle_turn_hashes(game);
+}
+
+void symmetric_move(int sym, struct move_t *move) {
+  static const int offsets[6] = {-9, -8, -1, 1, 8, 9};
+  uint32_t path = 0;
+  if (sym == 0 || move->src < 0) {
+    return;
   }
-  if (game->hash != 0) {
-    game->hash ^= _zobrist_color;
+  for (int i = 0; i < move->hops && move->hops <= MAX_PATH_HOPS; i++) {
+    // where the symmetry sends a hop in direction d from the centre
+    int d = move->path >> (3 * i) & 7;
+    int offset = d < 6 ? symmetric_square(sym, 40 + offsets[d]) - 40 : 0;
+    for (d = 0; d < 6 && offsets[d] != offset; d++) {
+    }
+    path |= (uint32_t)d << (3 * i);
   }
+  move->src = symmetric_square(sym, move->src);
+  move->dst = symmetric_square(sym, move->dst);
+  move->path = path;
+}
+
+void symmetric_game(int sym, struct game_t *game, struct game_t *out) {
+  uint128_t red = game->board.red, green = game->board.green;
+  int p;
+  *out = *game;
+  out->board.red = 0;
+  out->board.green = 0;
+  out->graph = NULL;
+  u128_for_each_1(red, p) {
+    out->board.pieces[sym & SYM_FLIP ? PIECE_GREEN : PIECE_RED] |=
+        MASK_AT(symmetric_square(sym, p));
+  }
+  u128_for_each_1(green, p) {
+    out->board.pieces[sym & SYM_FLIP ? PIECE_RED : PIECE_GREEN] |=
+        MASK_AT(symmetric_square(sym, p));
+  }
+  if (sym & SYM_FLIP) {
+    out->turn = opponent(game->turn);
+  }
+  game_hash(out);
 }
 
 int game_apply_move_with_check(struct game_t *game, struct move_t *move) {
@@ -289,24 +895,9 @@ int game_apply_move_with_check(struct game_t *game, struct move_t *move) {
     }
   }
 
-  LIST_HEAD(moves);
-  gen_moves(&(game->board), MASK_AT(move->src), &moves);
-  if (list_empty(&moves)) {
-    return -1;
-  }
-
-  struct move_t *m;
-  int found = 0;
-  while (!list_empty(&moves)) {
-    m = list_head_entry(&moves, struct move_t, list);
-    if (m->dst == move->dst) {
-      found = 1;
-    }
-    list_del(&m->list);
-    free(m);
-  }
-
-  if (!found) {
+  uint128_t dests[81];
+  gen_dests(&(game->board), MASK_AT(move->src), dests);
+  if (!(dests[move->src] >> move->dst & 1)) {
     return -1;
   }
 
@@ -344,6 +935,8 @@ void init_game(struct game_t *game) {
   game->board.green = INITIAL_GREEN;
   game->turn = PIECE_RED;
   game->round = 1;
+  game->graph = NULL;
+  game->symmetric = false;
   game_hash(game);
 }
 
@@ -353,6 +946,8 @@ void load_game(struct game_t *game, char *state) {
   game->turn = PIECE_RED;
   game->round = 0;
   game->hash = 0;
+  game->graph = NULL;
+  game->symmetric = false;
   char round[16];
   int round_len = 0;
   int p = 0;
@@ -384,6 +979,95 @@ void load_game(struct game_t *game, char *state) {
   game_hash(game);
 }
 
+// Bits of the red rank in a packed position, C(81, 10) < 2^41. The green rank,
+// below C(71, 10) < 2^39, sits above it.
+#define RED_RANK_BITS 41
+
+// Rank of ARMY_SIZE squares in the combinatorial number system: the sum of
+// C(p, k) over the squares, the k-th lowest taking k. `below` holds squares
+// that are skipped, so the army is ranked among the others only.
+static uint64_t rank_army(uint128_t army, uint128_t below) {
+  uint64_t rank = 0;
+  int k = ARMY_SIZE, p;
+  u128_for_each_1(army, p) {
+    int q = p - popcount_u128(below & (MASK_AT(p) - 1));
+    rank += _binomial[k--][q];
+  }
+  return rank;
+}
+
+// Largest q with C(q, k) <= *rank, taking C(q, k) off the rank. Rows being
+// non-decreasing, this counts the entries not above the rank among the 8 its
+// key starts at, without a branch to mispredict.
+static inline int unrank_square(uint64_t *rank, int k) {
+  int start = _unrank_start[k][rank_key(*rank)], q = start - 1;
+  for (int n = start; n < start + 8; n++) {
+    q += _binomial[k][n] <= *rank;
+  }
+  *rank -= _binomial[k][q];
+  return q;
+}
+
+// Inverse of rank_army for both armies. The two chains of dependent lookups
+// are interleaved, then the green squares step over the red ones.
+static void unrank_armies(uint64_t red_rank, uint64_t green_rank,
+                          struct board_t *board) {
+  int red[ARMY_SIZE], green[ARMY_SIZE];
+  for (int k = ARMY_SIZE; k >= 1; k--) {
+    red[ARMY_SIZE - k] = unrank_square(&red_rank, k);
+    green[ARMY_SIZE - k] = unrank_square(&green_rank, k);
+  }
+  board->red = 0;
+  board->green = 0;
+  for (int i = 0; i < ARMY_SIZE; i++) {
+    // red is highest first, the skipped squares must come lowest first
+    int p = green[i];
+    for (int j = ARMY_SIZE - 1; j >= 0; j--) {
+      p += red[j] <= p;
+    }
+    board->red |= MASK_AT(red[i]);
+    board->green |= MASK_AT(p);
+  }
+}
+
+bool game_pack(struct game_t *game, struct packed_game_t *packed) {
+  uint128_t red = game->board.red, green = game->board.green;
+  if (popcount_u128(red) != ARMY_SIZE || popcount_u128(green) != ARMY_SIZE ||
+      game->round < 0 || game->round >= 1 << 15) {
+    return false;
+  }
+  uint128_t ranks = (uint128_t)rank_army(green, red) << RED_RANK_BITS |
+                    rank_army(red, 0);
+  for (int i = 0; i < 10; i++) {
+    packed->bytes[i] = (uint8_t)(ranks >> (8 * i));
+  }
+  int tail = game->round << 1 | game->turn;
+  packed->bytes[10] = (uint8_t)tail;
+  packed->bytes[11] = (uint8_t)(tail >> 8);
+  return true;
+}
+
+bool game_unpack(struct game_t *game, struct packed_game_t *packed) {
+  uint128_t ranks = 0;
+  for (int i = 9; i >= 0; i--) {
+    ranks = ranks << 8 | packed->bytes[i];
+  }
+  uint64_t red_rank = (uint64_t)ranks & (((uint64_t)1 << RED_RANK_BITS) - 1);
+  uint64_t green_rank = (uint64_t)(ranks >> RED_RANK_BITS);
+  if (red_rank >= _binomial[ARMY_SIZE][81] ||
+      green_rank >= _binomial[ARMY_SIZE][81 - ARMY_SIZE]) {
+    return false;
+  }
+  int tail = packed->bytes[10] | packed->bytes[11] << 8;
+  unrank_armies(red_rank, green_rank, &game->board);
+  game->turn = tail & 1 ? PIECE_GREEN : PIECE_RED;
+  game->round = tail >> 1;
+  game->graph = NULL;
+  game->symmetric = false;
+  game_hash(game);
+  return true;
+}
+
 void draw_board(struct board_t *board) {
   int p = 0;
   for (int i = 0; i < 9; i++) {
@@ -423,8 +1107,7 @@ void draw_board(struct board_t *board) {
 }
 
 int game_evaluate(struct game_t *game) {
-  int p, red_score = 0, green_score = 0, red_moves_score = 0,
-         green_moves_score = 0;
+  int p, scores[2];
   uint128_t red = game->board.red;
   uint128_t green = game->board.green;
 
@@ -435,38 +1118,14 @@ int game_evaluate(struct game_t *game) {
     return game->turn == PIECE_GREEN ? SCORE_WIN : -SCORE_WIN;
   }
 
-  LIST_HEAD(red_moves);
-  LIST_HEAD(green_moves);
-
-  gen_moves(&(game->board), red, &red_moves);
-  gen_moves(&(game->board), green, &green_moves);
-
-  struct list_head *pos, *_n;
-  list_for_each_safe(pos, _n, &red_moves) {
-    struct move_t *move = list_entry(pos, struct move_t, list);
-    if (BOARD_DISTANCES[move->src] - BOARD_DISTANCES[move->dst] > 0) {
-      red_moves_score += 1;
-    }
-    list_del(pos);
-    free(move);
+  for (int color = PIECE_RED; color <= PIECE_GREEN; color++) {
+    uint128_t pieces = game->board.pieces[color];
+    scores[color] = 0;
+    u128_for_each_1(pieces, p) { scores[color] += SIDE_SCORES[color][p]; }
+    scores[color] = 3 * scores[color] + count_forward_moves(game, color);
   }
-  list_for_each_safe(pos, _n, &green_moves) {
-    struct move_t *move = list_entry(pos, struct move_t, list);
-    if (BOARD_DISTANCES[move->dst] - BOARD_DISTANCES[move->src] > 0) {
-      green_moves_score += 1;
-    }
-    list_del(pos);
-    free(move);
-  }
-
-  u128_for_each_1(red, p) { red_score += (SCORE_TABLE[80 - p]); }
-  u128_for_each_1(green, p) { green_score += (SCORE_TABLE[p]); }
-
-  red_score = 3 * red_score + red_moves_score;
-  green_score = 3 * green_score + green_moves_score;
 
-  return game->turn == PIECE_RED ? red_score - green_score
-                                 : green_score - red_score;
+  return scores[game->turn] - scores[opponent(game->turn)];
 }
 
 bool is_game_over(struct game_t *game) {
@@ -5,9 +5,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#include "list.h"
-
-#define uint128_t unsigned __int128
+#include "bitboard.h"
 
 #define BOARD_MASK (((uint128_t)0x1ffff << 64) | 0xffffffffffffffff)
 #define INITIAL_RED (((uint128_t)0x1e0e0 << 64) | 0x6020000000000000)
@@ -15,41 +13,191 @@
 #define MASK_AT(p) ((uint128_t)1 << p)
 #define SCORE_MAX (INT_MAX)
 #define SCORE_MIN (-INT_MAX)
-#define SCORE_NAN (INT_MIN)
 #define SCORE_WIN (99999)
+// Upper bound on the moves of one side: 10 pieces, each reaching at most the
+// 71 empty cells.
+#define MAX_MOVES 768
 
 extern const int BOARD_DISTANCES[81];
+extern const int SCORE_TABLE[81];
+extern const uint128_t ADJ_POSITIONS[81];
+
+// Per side to move, filled by init_movegen(): BOARD_DISTANCES negated for
+// green, so a move forward always lowers it, and the evaluator's square scores
+// mirrored (80 - p) for red. Both sides then read their table one way.
+extern int SIDE_DISTANCES[2][81];
+extern int SIDE_SCORES[2][81];
+
+// Squares a move of `color` from src to dst gets closer to the opponent's
+// corner, negative for moves backwards.
+#define forward_distance(color, src, dst) \
+  (SIDE_DISTANCES[color][src] - SIDE_DISTANCES[color][dst])
 
 enum color_t {
   PIECE_RED,
   PIECE_GREEN,
 };
 
+#define opponent(color) ((enum color_t)((color) ^ 1))
+
 struct board_t {
-  uint128_t red;
-  uint128_t green;
+  union {
+    struct {
+      uint128_t red;
+      uint128_t green;
+    };
+    // indexed by enum color_t
+    uint128_t pieces[2];
+  };
+};
+
+/**
+ * Single-jump landing squares of every square. When attached to a game it is
+ * kept in step by game_apply_move/game_undo_move, which only update the jumps
+ * over and onto `src` and `dst`.
+ */
+struct jump_graph_t {
+  uint128_t jumps[81];
 };
 
+// Board symmetries: the reflection across the long diagonal (r * 9 + c to
+// c * 9 + r) and the colour flip (p to 80 - p with colours and side to move
+// swapped). A symmetry is a combination of these bits, 0 to 3.
+#define SYM_TRANSPOSE 1
+#define SYM_FLIP 2
+
 struct game_t {
   struct board_t board;
   enum color_t turn;
   int round;
   uint64_t hash;
+  struct jump_graph_t *graph;
+  // With `symmetric` set, sym_hash[s - 1] is kept up to date with the key of
+  // the position mapped by symmetry s, see game_canonical_hash().
+  bool symmetric;
+  uint64_t sym_hash[3];
+};
+
+enum movegen_impl_t {
+  MOVEGEN_GENERIC,
+  MOVEGEN_BMI2,
+  MOVEGEN_SETWISE,
+  MOVEGEN_COMPONENTS,
 };
 
+// Longest jump chain a move_t carries the path of, 3 bits per hop.
+#define MAX_PATH_HOPS 10
+
+/**
+ * A move from `src` to `dst`. Jumps may carry their hop path: the direction of
+ * hop i (in hash_adj order: -9, -8, -1, +1, +8, +9) in bits 3i..3i+2 of
+ * `path`. With a path a stored move is validated hop by hop instead of by a
+ * flood fill. `hops` is 0 for steps and for moves whose path isn't known, as
+ * built from src and dst alone.
+ */
 struct move_t {
   int8_t src;
   int8_t dst;
-  struct list_head list;
+  uint8_t hops;
+  uint32_t path;
+};
+
+/**
+ * Fixed-capacity move buffer. The search owns one per ply, so generating moves
+ * never touches the heap.
+ */
+struct move_list_t {
+  int len;
+  struct move_t moves[MAX_MOVES];
+};
+
+// Boards per gen_moves_batch call.
+#define BATCH_SIZE 8
+
+/**
+ * Structure-of-arrays block of boards for gen_moves_batch: the low (index 0)
+ * and high (index 1) 64 bits of the boards sit next to each other, so one
+ * vector load fetches the same half of several boards. `turn` holds the
+ * enum color_t of the side to move of each board.
+ */
+struct board_batch_t {
+  int len;
+  uint64_t red[2][BATCH_SIZE];
+  uint64_t green[2][BATCH_SIZE];
+  uint64_t turn[BATCH_SIZE];
+};
+
+enum batch_impl_t {
+  BATCH_GENERIC,
+  BATCH_AVX2,
+  BATCH_AVX512,
+};
+
+/**
+ * Destination sets of the side to move in one position, filled lazily per
+ * source square: a search node validates its killers and then generates its
+ * moves from the same floods. `known` marks the filled entries of `dests`.
+ */
+struct reach_cache_t {
+  uint128_t known;
+  uint128_t dests[81];
+};
+
+// Pieces per side, the size of every army game_pack() ranks.
+#define ARMY_SIZE 10
+#define PACKED_GAME_SIZE 12
+
+/**
+ * Position in PACKED_GAME_SIZE bytes. Bytes 0..9 hold, little-endian, the
+ * rank of the red army among all C(81, 10) placements in the low 41 bits and
+ * the rank of the green army among the 71 squares red leaves empty in the 39
+ * bits above. Bytes 10..11 hold round << 1 | turn, also little-endian. The
+ * record is an eighth of the game_str text and decodes without parsing.
+ */
+struct packed_game_t {
+  uint8_t bytes[PACKED_GAME_SIZE];
 };
 
-#define INIT_BOARD {INITIAL_RED, INITIAL_GREEN}
+#define INIT_BOARD {.red = INITIAL_RED, .green = INITIAL_GREEN}
 
 void init_zobrist();
 
-int gen_moves(struct board_t *board, uint128_t from, struct list_head *moves);
+// Select the move generator chosen at build time with -DMOVEGEN=..., by default
+// the fastest table lookup the CPU supports.
+void init_movegen();
 
-void sort_moves(struct list_head *moves, enum color_t color);
+// Force a move generator, returns false if the CPU doesn't support it.
+bool set_movegen_impl(enum movegen_impl_t impl);
+
+void gen_dests(struct board_t *board, uint128_t from, uint128_t *dests);
+
+int gen_moves(struct board_t *board, uint128_t from, struct move_list_t *moves);
+
+// Force a batched move generator, returns false if the CPU doesn't support it.
+// init_movegen() picks the widest supported one.
+bool set_batch_impl(enum batch_impl_t impl);
+
+// Append a board and the side to move to a batch, returns false if it is full.
+bool batch_add_board(struct board_batch_t *batch, struct board_t *board,
+                     enum color_t turn);
+
+// Generate the moves of the side to move of every board in the batch, appending
+// them to moves[0 .. batch->len - 1] in gen_moves order. Returns the total
+// number of moves.
+int gen_moves_batch(struct board_batch_t *batch, struct move_list_t *moves);
+
+void game_attach_jump_graph(struct game_t *game, struct jump_graph_t *graph);
+
+void game_gen_dests(struct game_t *game, uint128_t from, uint128_t *dests);
+
+int game_gen_moves(struct game_t *game, uint128_t from,
+                   struct move_list_t *moves);
+
+// Number of moves of `color` that get closer to the opponent's corner, counted
+// on destination bitboards without generating the moves.
+int count_forward_moves(struct game_t *game, enum color_t color);
+
+void sort_moves(struct move_list_t *moves, enum color_t color);
 
 void jump_moves(struct board_t *board, int src, uint128_t *to);
 
@@ -73,10 +221,56 @@ void load_game(struct game_t *game, char *state);
 
 void init_game(struct game_t *game);
 
+// Pack a position with ARMY_SIZE pieces per side and a round below 32768,
+// returns false for any other.
+bool game_pack(struct game_t *game, struct packed_game_t *packed);
+
+// Load a packed position like load_game, returns false if the record is out
+// of range.
+bool game_unpack(struct game_t *game, struct packed_game_t *packed);
+
+// A move with a path is checked hop by hop and is only valid along that path;
+// moves without one are checked by a flood fill.
 bool game_is_move_valid(struct game_t *game, struct move_t *move);
 
+// Destinations of the pieces in `from`, computing only the ones not cached yet.
+void game_fill_reach(struct game_t *game, struct reach_cache_t *cache,
+                     uint128_t from);
+
+// game_is_move_valid for the side to move, through the cache: moves with a
+// path are still checked hop by hop, others fill their source's entry.
+bool game_is_move_reachable(struct game_t *game, struct reach_cache_t *cache,
+                            struct move_t *move);
+
+// Fill in the shortest hop path of a jump move in the current position.
+// Returns false if the move isn't legal; legal moves whose path doesn't fit in
+// MAX_PATH_HOPS are left without a path.
+bool game_find_move_path(struct game_t *game, struct move_t *move);
+
+// Squares visited by a move, src first and dst last, returns their number.
+// Moves without a path give just src and dst.
+int move_squares(struct move_t *move, int8_t *squares);
+
+// Format a move as its visited squares, e.g. "03-21-23".
+void move_str(struct move_t *move, char *str);
+
 bool is_game_over(struct game_t *game);
 
 uint64_t game_hash(struct game_t *game);
 
+// Keep the keys of the mirrored positions up to date, or stop doing so.
+void game_set_symmetric(struct game_t *game, bool symmetric);
+
+// The smallest key of the position and its mirror images (only game->hash if
+// the game isn't symmetric), and the symmetry it was taken under.
+uint64_t game_canonical_hash(struct game_t *game, int *sym);
+
+// Map a square, a move (with its path) or a whole position by a symmetry.
+// Every symmetry is its own inverse.
+int symmetric_square(int sym, int p);
+
+void symmetric_move(int sym, struct move_t *move);
+
+void symmetric_game(int sym, struct game_t *game, struct game_t *out);
+
 #endif  // _CHECKERS_H
\ No newline at end of file
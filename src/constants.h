@@ -1,5431 +0,0 @@
-const __uint128_t ADJ_POSITIONS[81] = {
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000202,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000605,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000c0a,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001814,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000003028,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000006050,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x000000000000c0a0,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000018140,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000030080,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040403,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x00000000000c0a06,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x000000000018140c,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000302818,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000605030,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000c0a060,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x00000000018140c0,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000003028180,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000006010100,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008080600,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000018140c00,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000030281800,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000060503000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x00000000c0a06000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x000000018140c000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000302818000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000605030000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000000c02020000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x00000010100c0000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000003028180000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000006050300000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x000000c0a0600000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000018140c00000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000030281800000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000060503000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x00000c0a06000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000180404000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000202018000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000605030000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0000c0a060000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x00018140c0000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0003028180000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0006050300000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x000c0a0600000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0018140c00000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0030080800000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0040403000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x00c0a06000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x018140c000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0302818000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0605030000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x0c0a060000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x18140c0000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x3028180000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x6010100000000000,
-    ((__uint128_t)0x0000000000000000 << 64) | 0x8080600000000000,
-    ((__uint128_t)0x0000000000000001 << 64) | 0x8140c00000000000,
-    ((__uint128_t)0x0000000000000003 << 64) | 0x0281800000000000,
-    ((__uint128_t)0x0000000000000006 << 64) | 0x0503000000000000,
-    ((__uint128_t)0x000000000000000c << 64) | 0x0a06000000000000,
-    ((__uint128_t)0x0000000000000018 << 64) | 0x140c000000000000,
-    ((__uint128_t)0x0000000000000030 << 64) | 0x2818000000000000,
-    ((__uint128_t)0x0000000000000060 << 64) | 0x5030000000000000,
-    ((__uint128_t)0x00000000000000c0 << 64) | 0x2020000000000000,
-    ((__uint128_t)0x0000000000000101 << 64) | 0x00c0000000000000,
-    ((__uint128_t)0x0000000000000302 << 64) | 0x8180000000000000,
-    ((__uint128_t)0x0000000000000605 << 64) | 0x0300000000000000,
-    ((__uint128_t)0x0000000000000c0a << 64) | 0x0600000000000000,
-    ((__uint128_t)0x0000000000001814 << 64) | 0x0c00000000000000,
-    ((__uint128_t)0x0000000000003028 << 64) | 0x1800000000000000,
-    ((__uint128_t)0x0000000000006050 << 64) | 0x3000000000000000,
-    ((__uint128_t)0x000000000000c0a0 << 64) | 0x6000000000000000,
-    ((__uint128_t)0x0000000000018040 << 64) | 0x4000000000000000,
-    ((__uint128_t)0x0000000000000201 << 64) | 0x8000000000000000,
-    ((__uint128_t)0x0000000000000503 << 64) | 0x0000000000000000,
-    ((__uint128_t)0x0000000000000a06 << 64) | 0x0000000000000000,
-    ((__uint128_t)0x000000000000140c << 64) | 0x0000000000000000,
-    ((__uint128_t)0x0000000000002818 << 64) | 0x0000000000000000,
-    ((__uint128_t)0x0000000000005030 << 64) | 0x0000000000000000,
-    ((__uint128_t)0x000000000000a060 << 64) | 0x0000000000000000,
-    ((__uint128_t)0x00000000000140c0 << 64) | 0x0000000000000000,
-    ((__uint128_t)0x0000000000008080 << 64) | 0x0000000000000000,
-};
-const __uint128_t JUMP_POSITIONS[81][64] = {
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000011,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040011,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100011,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000140000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000140001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000140010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000140011,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000022,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080022,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200022,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280022,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000044,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100044,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400044,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000500004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000500040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000500044,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000088,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200088,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800088,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000a00008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000a00080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000a00088,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000110,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400110,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000110,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001400010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001400110,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000005000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028002200,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050004400,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0008800,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140011000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140011000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280022000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280022000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500004000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000a00000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000a00000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000a00008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000a00008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000005,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100005,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000005,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000100001,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000100004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000100005,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000020000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000020000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000020000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000020000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200020000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200020000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200000000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200020000a,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200002,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000200020000a,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000440000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000440004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000440010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000440014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000040004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000040010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000040014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000400004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000400010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000400014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000440000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000440004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000440010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000440014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000040004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000040010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000040014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000400004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000400010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000400014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000440000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000440004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000440010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000440014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000000004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000000014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000040004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000040010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000040014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000400004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000400010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000400014,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000440000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000440004,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000440010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000440014,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000880000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000880008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000880020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000880028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000080020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000080028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000800008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000800028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000880000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000880008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000880020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000880028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000800008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000800028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000880000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000880008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000880020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000880028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000080008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000080020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000080028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000800008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000800020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000800028,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000880000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000880008,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000880020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000880028,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001100050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000100050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001100050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000100050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001100050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000100050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001000010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001000050,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001100010,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001100040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014001100050,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000000000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000002000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000020000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000022000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000080000000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000080002000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000080020000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000080022000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000200000000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000200002000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000200020000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000200022000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028000000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000280000000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028000200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028000200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000280002000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028002000020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028002000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000280020000a0,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028002200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028002200020,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028002200080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000280022000a0,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004400140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000400140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004400140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000400140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004400140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000400140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004000040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004000140,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004400040,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004400100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050004400140,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000800080,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040001000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100001000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000140000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000140000000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000140001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000140001000100,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000a00,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000a00,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000a00,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200020000200,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200020000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200020000a00,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000400,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040001400,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000088000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000088000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000088002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000088002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200008002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200080002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200088000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200088000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200088002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200088002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800008002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800080002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800088000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800088000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800088002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800088002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00000000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00000002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00008000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00008002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00008002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00080000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00080002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00080002800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00088000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00088000800,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00088002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00088002800,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000110000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000110001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000110004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000110005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400010005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400100005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400110000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400110001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400110004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400110005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000100005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000110000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000110001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000110004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000110005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400010001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400010004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400010005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400100001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400100004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400100005000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400110000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400110001000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400110004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400110005000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000000000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000002000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000020000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000220000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000220002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000220008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000022000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000080000000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000080002000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800200008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000080020000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800220000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800220002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800220008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000080022000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000200000000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000200002000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000200008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000200020000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000220000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000220002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000220008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000200022000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800000002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000280000000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800020002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800020008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000280002000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800200002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800200008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000280020000a000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800220000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800220002000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800220008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000280022000a000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000440000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000440004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000440010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000440014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000400010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000400014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000440000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000440004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000440010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000440014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000040014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000440000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000440004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000440010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000440014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000040004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000040010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000040014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000400004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000400010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000400014000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000440000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000440004000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000440010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000440014000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000880000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000880008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000880020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000880028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000080028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000800008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000800020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000800028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000880000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000880008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000880020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000880028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000080028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000800008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000800020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000800028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000880000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000880008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000880020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000880028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000080008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000080020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000080028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000800008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000800020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000800028000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000880000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000880008000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000880020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000880028000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100010000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000100010000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000000020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000200020000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000140000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000140000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000140000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040004000040000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040004000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040004000140000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000280000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000080000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000280000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000011000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000011000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000011000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000011000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040001000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040001000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040001000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040010000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040010000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040010000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040011000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040011000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040011000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040011000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100001000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100001000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100001000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100010000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100010000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100010000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100011000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100011000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100011000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100011000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140000000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140000000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140001000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140001000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140001000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140010000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140010000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140010000500000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140011000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140011000100000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140011000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140011000500000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000022000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000022000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000022000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000022000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080002000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080002000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080020000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080020000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080022000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080022000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080022000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080022000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200020000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200020000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200022000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200022000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200022000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200022000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280000000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280000000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280002000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280002000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280002000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280020000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280020000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280020000a00000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280022000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280022000200000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280022000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280022000a00000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000044000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000044000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000044001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000044001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100004000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100004001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100004001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100040000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100040001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100040001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100044000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100044000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100044001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100044001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400004000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400004001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400004001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400040000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400040001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400040001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400044000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400044000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400044001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400044001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500000000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500000001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500004000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500004001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500004001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500040000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500040001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500040001400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500044000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500044000400000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500044001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500044001400000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000088000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000088000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000088002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000088002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200080002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200080002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200088000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200088000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200088002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200088002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800008000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800008002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800008002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800088000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800088000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800088002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800088002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00000000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00000002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00008000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00008002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00008002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00080000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00080002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00080002800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00088000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00088000800000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00088002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00088002800000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000110000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000110001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000110004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000110005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400010001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400010004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400010005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400100001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400100004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400100005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400110000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400110001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400110004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400110005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000010001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000010004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000010005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000100001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000100004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000100005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000110000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000110001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000110004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000110005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400000001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400000005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400010001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400010004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400010005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400100001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400100004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400100005000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400110000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400110001000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400110004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400110005000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020002000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800020002000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000040004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000040004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x5000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x5000000004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x5000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x5000040004000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800008000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800028000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000050000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000050000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000010000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000050000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00002000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00020000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002200020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002200080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00022000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x80000000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000200020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000200080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x80002000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002000020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x80020000a0000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002200020000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002200080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x80022000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x00000000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000200020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000200080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x00002000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002000020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002000080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x00020000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002200000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002200020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002200080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x00022000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8000000020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8000000080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x80000000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8000200000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8000200020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8000200080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x80002000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8002000020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8002000080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x80020000a0000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8002200000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8002200020000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x8002200080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x80022000a0000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400140000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000140000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004400040000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004400100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004400140000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000400100000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000400140000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000140000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004400000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004400040000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004400100000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004400140000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400140000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000040000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000140000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004400040000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004400100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004400140000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000000040000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000000140000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000400040000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000400100000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0000400140000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004000040000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004000100000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004000140000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004400000000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004400040000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004400100000000,
-        ((__uint128_t)0x0000000000000005 << 64) | 0x0004400140000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000280000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800280000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000280000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008800080000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008800200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008800280000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000280000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000800080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000800200000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000800280000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000200000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000280000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008800000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008800080000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008800200000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008800280000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000080000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000280000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800080000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800280000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000080000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000280000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008800080000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008800200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008800280000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000000000000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000000080000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000000200000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000000280000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000800000000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000800080000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000800200000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0000800280000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008000000000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008000080000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008000200000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008000280000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008800000000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008800080000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008800200000000,
-        ((__uint128_t)0x000000000000000a << 64) | 0x0008800280000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000500000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0011000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0011000100000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0011000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0011000500000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000400000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000500000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000400000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000500000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0011000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0011000100000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0011000400000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0011000500000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000100000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000500000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000500000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0011000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0011000100000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0011000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0011000500000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0000000100000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0000000500000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0001000100000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0001000400000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0001000500000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0010000100000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0010000400000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0010000500000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0011000000000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0011000100000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0011000400000000,
-        ((__uint128_t)0x0000000000000014 << 64) | 0x0011000500000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000a00000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000a00000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000a00000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0022000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0022000200000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0022000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0022000a00000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000a00000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000800000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000a00000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000800000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000a00000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0022000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0022000200000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0022000800000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0022000a00000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000a00000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000200000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000800000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000a00000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000200000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000800000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000a00000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0022000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0022000200000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0022000800000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0022000a00000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0000000200000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0000000a00000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0002000200000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0002000800000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0002000a00000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0020000200000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0020000800000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0020000a00000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0022000000000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0022000200000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0022000800000000,
-        ((__uint128_t)0x0000000000000028 << 64) | 0x0022000a00000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0000000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000400000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000050 << 64) | 0x0004000400000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0008000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0008000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x00000000000000a0 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x00000000000000a0 << 64) | 0x0000000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x00000000000000a0 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x00000000000000a0 << 64) | 0x0008000800000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000005000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100001000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100005000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000001000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000005000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0100001000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0100004000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0100005000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x020000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x020000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x020000a000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x020000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x020000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x020000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x000000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x020000a000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200002000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x020000a000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000014000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040014000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400014000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0440000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0440004000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0440010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0440014000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000014000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0040004000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0040010000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0040014000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0400004000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0400010000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0400014000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0440000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0440004000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0440010000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0440014000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000014000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0040004000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0040010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0040014000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0400004000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0400010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0400014000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0440000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0440004000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0440010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0440014000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0000004000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0000014000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0040004000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0040010000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0040014000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0400004000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0400010000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0400014000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0440000000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0440004000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0440010000000000,
-        ((__uint128_t)0x0000000000000500 << 64) | 0x0440014000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000028000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080028000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800028000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0880000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0880008000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0880020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0880028000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000028000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0080020000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0080028000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0800008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0800028000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0880000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0880008000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0880020000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0880028000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000028000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0080020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0080028000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0800008000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0800028000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0880000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0880008000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0880020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0880028000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0000008000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0000028000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0080008000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0080020000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0080028000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0800008000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0800020000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0800028000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0880000000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0880008000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0880020000000000,
-        ((__uint128_t)0x0000000000000a00 << 64) | 0x0880028000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000050000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100050000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000050000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1100000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1100010000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1100040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1100050000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000050000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0100010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0100040000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0100050000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1000010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1000040000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1000050000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1100000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1100010000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1100040000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1100050000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000050000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0100010000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0100040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0100050000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1000010000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1000040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1000050000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1100000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1100010000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1100040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1100050000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0000010000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0000050000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0100010000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0100040000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x0100050000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1000010000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1000040000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1000050000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1100000000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1100010000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1100040000000000,
-        ((__uint128_t)0x0000000000001400 << 64) | 0x1100050000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x02000a0000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x20000a0000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2200020000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2200080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x22000a0000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0200020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0200080000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x02000a0000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2000080000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x20000a0000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2200000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2200020000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2200080000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x22000a0000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0200020000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0200080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x02000a0000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2000080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x20000a0000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2200000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2200020000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2200080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x22000a0000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x0000020000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x00000a0000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x0200020000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x0200080000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x02000a0000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x2000020000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x2000080000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x20000a0000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x2200000000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x2200020000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x2200080000000000,
-        ((__uint128_t)0x0000000000002800 << 64) | 0x22000a0000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000140000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400140000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000140000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4400040000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4400100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4400140000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000140000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0400040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0400100000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0400140000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4000040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4000100000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4000140000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4400000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4400040000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4400100000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4400140000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000140000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0400040000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0400100000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0400140000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4000040000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4000100000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4000140000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4400000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4400040000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4400100000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4400140000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0000040000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0000140000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0400040000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0400100000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x0400140000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4000040000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4000100000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4000140000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4400000000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4400040000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4400100000000000,
-        ((__uint128_t)0x0000000000005000 << 64) | 0x4400140000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0000080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800080000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x000000000000a000 << 64) | 0x0800080000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x1000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x1000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000014000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000014000 << 64) | 0x0000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000014000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000014000 << 64) | 0x1000100000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000a00000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000a00000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000200000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000a00000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000400000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0001400000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x8002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0002800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8000800000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x8002800000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000001 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0005000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0001000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000011 << 64) | 0x0005000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000002 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x000a000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0002000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000022 << 64) | 0x000a000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000004 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000040 << 64) | 0x0014000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0004000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000044 << 64) | 0x0014000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000008 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000080 << 64) | 0x0028000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0008000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000088 << 64) | 0x0028000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000010 << 64) | 0x0010000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000020 << 64) | 0x0020000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0140000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0040000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0140000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0280000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0280000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0080000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0280000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0500000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000100 << 64) | 0x0500000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0500000000000000,
-        ((__uint128_t)0x0000000000001100 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000001100 << 64) | 0x0100000000000000,
-        ((__uint128_t)0x0000000000001100 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000001100 << 64) | 0x0500000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0a00000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000200 << 64) | 0x0a00000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0a00000000000000,
-        ((__uint128_t)0x0000000000002200 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002200 << 64) | 0x0200000000000000,
-        ((__uint128_t)0x0000000000002200 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000002200 << 64) | 0x0a00000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1400000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000400 << 64) | 0x1400000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x1400000000000000,
-        ((__uint128_t)0x0000000000004400 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004400 << 64) | 0x0400000000000000,
-        ((__uint128_t)0x0000000000004400 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000004400 << 64) | 0x1400000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000800 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000008000 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000008800 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000008800 << 64) | 0x0800000000000000,
-        ((__uint128_t)0x0000000000008800 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000008800 << 64) | 0x2800000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x5000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000001000 << 64) | 0x5000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000010000 << 64) | 0x5000000000000000,
-        ((__uint128_t)0x0000000000011000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000011000 << 64) | 0x1000000000000000,
-        ((__uint128_t)0x0000000000011000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000011000 << 64) | 0x5000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000002000 << 64) | 0x2000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-    {
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000004000 << 64) | 0x4000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-        ((__uint128_t)0x0000000000000000 << 64) | 0x0000000000000000,
-    },
-};
@@ -9,7 +9,6 @@
 #include <string.h>
 
 #include "../checkers.h"
-#include "../list.h"
 #include "../search.h"
 
 #define SCREEN_WIDTH 400
@@ -84,36 +83,26 @@ void draw_board_background(Vector2 *points, float r) {
   rlEnd();
 }
 
+void print_search_depth(struct search_result_t *result) {
+  printf("Depth: %2d, Eval: %6d, Move: %02d->%02d, Time: %.3fs\n",
+         result->depth, result->score, result->best_move.src,
+         result->best_move.dst, result->seconds);
+}
+
 void *search_ai_move(void *arg) {
-  ai_last_move = (struct move_t){-1, -1};
+  ai_last_move = (struct move_t){.src = -1, .dst = -1};
   struct game_t _game = game;
-  struct move_t best_move;
-  clock_t stop_time = clock() + CLOCKS_PER_SEC * 5;
-  clear_hash_table();
-  int alpha = SCORE_MIN;
-  int beta = SCORE_MAX;
-  int val_window = 100;
-  for (int d = 1; d <= 32; d++) {
-    if (clock() > stop_time) {
-      break;
-    }
-    clear_killer_moves();
-    struct move_t _best_move;
-    int eval =
-        alpha_beta_search(&_game, d, alpha, beta, &_best_move, stop_time);
-    if (eval != SCORE_NAN) {
-      printf("Depth: %2d, Eval: %6d, Move: %02d->%02d\n", d, eval,
-             _best_move.src, _best_move.dst);
-      if (eval == SCORE_WIN) {
-        best_move = _best_move;
-        break;
-      }
-      best_move = _best_move;
-    }
-  }
-  printf("AI move: %02d->%02d\n", best_move.src, best_move.dst);
-  game_apply_move(&game, &best_move);
+  struct search_result_t result;
+  struct search_control_t control;
+  init_search_control(&control, 5);
+  next_hash_generation();
+  search_iterative(&_game, 32, &control, print_search_depth, &result);
+  struct move_t best_move = result.best_move;
   char str[128];
+  game_find_move_path(&game, &best_move);
+  move_str(&best_move, str);
+  printf("AI move: %s\n", str);
+  game_apply_move(&game, &best_move);
   game_str(&game, str);
   printf("Board: %s\n", str);
   ai_last_move = best_move;
@@ -131,17 +120,12 @@ void handle_click(int p) {
                                 : game.board.green >> p & 1 && selected != p) {
     selected = p;
     selected_moves = 0;
-    LIST_HEAD(moves);
-    gen_moves(&game.board, MASK_AT(selected), &moves);
-    struct list_head *pos, *_n;
-    list_for_each_safe(pos, _n, &moves) {
-      struct move_t *move = list_entry(pos, struct move_t, list);
-      selected_moves |= MASK_AT(move->dst);
-      list_del(pos);
-      free(move);
-    }
+    uint128_t dests[81];
+    gen_dests(&game.board, MASK_AT(selected), dests);
+    selected_moves = dests[selected];
   } else if (selected_moves >> p & 1) {
     struct move_t move = {selected, p};
+    game_find_move_path(&game, &move);
     player_last_move = move;
     game_apply_move(&game, &move);
     selected = -1;
@@ -258,6 +242,10 @@ void gui_draw_board(float x0, float y0, float r, float gap) {
   Vector2 points[5];
   int points_len = 0;
   Vector2 center;
+  // squares the AI's last move went through, hop by hop
+  int8_t last_squares[MAX_PATH_HOPS + 1];
+  int last_squares_len =
+      ai_last_move.src == -1 ? 0 : move_squares(&ai_last_move, last_squares);
 
   int key_code = GetKeyPressed();
 
@@ -265,7 +253,7 @@ void gui_draw_board(float x0, float y0, float r, float gap) {
       player_last_move.src != -1) {
     game_undo_move(&game, &ai_last_move);
     game_undo_move(&game, &player_last_move);
-    ai_last_move = (struct move_t){-1, -1};
+    ai_last_move = (struct move_t){.src = -1, .dst = -1};
   }
 
   foreach_circle(dx, dy, r, gap, p) {
@@ -296,10 +284,14 @@ void gui_draw_board(float x0, float y0, float r, float gap) {
     _p = player_color == PIECE_RED ? p : 80 - p;
     gui_draw_circle(x0 + dx, y0 + dy, r, _p);
 
-    if (ai_last_move.src == _p || ai_last_move.dst == _p) {
-      DrawRectangleV((Vector2){x0 + dx - marker_half, y0 + dy - marker_half},
-                     (Vector2){marker_size, marker_size},
-                     ColorAlpha(WHITE, 0.7));
+    for (int i = 0; i < last_squares_len; i++) {
+      if (last_squares[i] == _p) {
+        bool end = i == 0 || i == last_squares_len - 1;
+        DrawRectangleV(
+            (Vector2){x0 + dx - marker_half, y0 + dy - marker_half},
+            (Vector2){marker_size, marker_size},
+            ColorAlpha(WHITE, end ? 0.7 : 0.4));
+      }
     }
   }
 
@@ -312,8 +304,8 @@ void gui_draw_board(float x0, float y0, float r, float gap) {
 }
 
 int main(int argc, char *argv[]) {
-  if (argc != 2) {
-    printf("Usage: %s [red|green]\n", argv[0]);
+  if (argc < 2 || argc > 4) {
+    printf("Usage: %s [red|green] [threads] [hash_mb]\n", argv[0]);
     return 1;
   }
   if (strcmp(argv[1], "red") == 0) {
@@ -321,12 +313,20 @@ int main(int argc, char *argv[]) {
   } else if (strcmp(argv[1], "green") == 0) {
     player_color = PIECE_GREEN;
   } else {
-    printf("Usage: %s [red|green]\n", argv[0]);
+    printf("Usage: %s [red|green] [threads] [hash_mb]\n", argv[0]);
+    return 1;
+  }
+  if (argc >= 3) {
+    set_search_threads(atoi(argv[2]));
+  }
+  if (argc >= 4 && !set_hash_mb(atoi(argv[3]))) {
+    printf("Can't allocate a %s MB hash table\n", argv[3]);
     return 1;
   }
   freopen("/dev/null", "w", stderr);
 
   init_zobrist();
+  init_movegen();
   init_game(&game);
 
   if (player_color == PIECE_GREEN) {
@@ -1,26 +1,107 @@
 #include <inttypes.h>
 #include <limits.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "checkers.h"
-#include "list.h"
 #include "search.h"
 
-void print_all_moves(struct list_head *head) {
-  struct move_t *entry;
-  list_for_each_entry(entry, head, list) {
-    printf("Move: %02d->%02d\n", entry->src, entry->dst);
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Heap allocations seen by `checkers bench`, to show that the search does not
+// allocate per node. Counted from every thread, helpers included, and only
+// where malloc, calloc and realloc can be interposed.
+static _Atomic uint64_t _heap_allocs = 0;
+
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size) {
+  atomic_fetch_add_explicit(&_heap_allocs, 1, memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+  atomic_fetch_add_explicit(&_heap_allocs, 1, memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+  atomic_fetch_add_explicit(&_heap_allocs, 1, memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+#endif
+
+// Branch misses of this process in user space, from the CPU's performance
+// counters. Returns -1 where they can't be read (no PMU, e.g. in most VMs, or
+// perf_event_paranoid too high).
+int open_branch_misses() {
+#ifdef __linux__
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+  return -1;
+#endif
+}
+
+uint64_t read_branch_misses(int fd) {
+  uint64_t count = 0;
+#ifdef __linux__
+  if (fd >= 0 && read(fd, &count, sizeof(count)) != sizeof(count)) {
+    count = 0;
+  }
+#endif
+  return count;
+}
+
+void close_branch_misses(int fd) {
+#ifdef __linux__
+  if (fd >= 0) {
+    close(fd);
+  }
+#endif
+}
+
+const char *MOVEGEN_NAMES[] = {"generic", "bmi2", "setwise", "components"};
+
+const char *BENCH_POSITIONS[] = {
+    "222200000/222000000/220000000/200000000/000000000/000000001/000000011/"
+    "000000111/000001111 r 1",
+    "222200000/222000000/220000000/020000000/000000000/000000011/000000011/"
+    "000000110/000001111 g 2",
+    "000200000/002000000/020220000/022200000/012010120/000110100/000000010/"
+    "000011000/000000001 g 10",
+};
+
+void print_all_moves(struct move_list_t *moves) {
+  for (int i = 0; i < moves->len; i++) {
+    printf("Move: %02d->%02d\n", moves->moves[i].src, moves->moves[i].dst);
   }
 }
 
 int main1(int argc, char *argv[]) {
-  struct game_t game = {INIT_BOARD, PIECE_RED, 1};
-  LIST_HEAD(moves);
-  game_apply_move(&game, &(struct move_t){53, 52});
-  game_apply_move(&game, &(struct move_t){27, 28});
-  game_apply_move(&game, &(struct move_t){71, 51});
+  struct game_t game = {.board = INIT_BOARD, .turn = PIECE_RED, .round = 1};
+  struct move_list_t moves = {0};
+  game_apply_move(&game, &(struct move_t){.src = 53, .dst = 52});
+  game_apply_move(&game, &(struct move_t){.src = 27, .dst = 28});
+  game_apply_move(&game, &(struct move_t){.src = 71, .dst = 51});
   gen_moves(&game.board, game.board.red, &moves);
   sort_moves(&moves, 1);
   print_all_moves(&moves);
@@ -28,51 +109,694 @@ int main1(int argc, char *argv[]) {
   return 0;
 }
 
-// int main(void) {
-//   init_zobrist();
-//   struct game_t game = {INIT_BOARD, PIECE_RED, 1, 0};
-//   game_hash(&game);
-//   struct move_t user_move = {-1, -1};
-//   struct move_t best_move = {-1, -1};
-
-//   while (1) {
-//     draw_board(&game.board);
-
-//     if (game.turn == PIECE_RED) {
-//       printf("Your turn (RED). Enter your move (src dst): ");
-//       if (scanf("%hhu %hhu", &user_move.src, &user_move.dst) != 2) {
-//         printf("Invalid input. Please enter two integers.\n");
-//         continue;
-//       }
-//       game_apply_move(&game, &user_move);
-//     } else {
-//       printf("AI's turn (GREEN).\n");
-//       clock_t stop_time = clock() + CLOCKS_PER_SEC * 8;
-//       clear_hash_table();
-//       for (int d = 3; d <= 16; d++) {
-//         if (clock() > stop_time) {
-//           break;
-//         }
-//         struct move_t _best_move;
-//         int eval = alpha_beta_search(&game, d, SCORE_MIN, SCORE_MAX,
-//                                      &_best_move, stop_time);
-//         if (eval != SCORE_NAN) {
-//           best_move = _best_move;
-//           printf("Depth: %d, Eval: %d\n", d, eval);
-//         }
-//       }
-
-//       printf("AI move: %02d->%02d\n", best_move.src, best_move.dst);
-//       game_apply_move(&game, &best_move);
-//     }
-//   }
-
-//   return 0;
-// }
-
-int main(void) {
-  LIST_HEAD(moves);
+double bench_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Deepen bench searches with full-window alpha_beta_search calls instead of
+// search_iterative().
+static bool _plain_deepening = false;
+
+// Search the bench positions to `depth`, returning the total time in seconds.
+double bench_search(int depth, bool jump_graph, bool symmetric) {
+  uint64_t total_nodes = 0, total_allocs = 0;
+  double total_time = 0;
+  struct jump_graph_t graph;
+  int branch_misses = open_branch_misses();
+  uint64_t misses = read_branch_misses(branch_misses);
+  for (size_t i = 0; i < sizeof(BENCH_POSITIONS) / sizeof(char *); i++) {
+    struct game_t game;
+    struct move_t best_move = {.src = -1, .dst = -1};
+    load_game(&game, (char *)BENCH_POSITIONS[i]);
+    if (jump_graph) {
+      game_attach_jump_graph(&game, &graph);
+    }
+    game_set_symmetric(&game, symmetric);
+    clear_hash_table();
+    clear_history();
+    clear_searched_nodes();
+    uint64_t allocs = _heap_allocs;
+    double start = bench_time();
+    if (_plain_deepening) {
+      start_search_helpers(&game);
+      for (int d = 1; d <= depth; d++) {
+        clear_killer_moves();
+        alpha_beta_search(&game, d, SCORE_MIN, SCORE_MAX, &best_move, NULL);
+      }
+      stop_search_helpers();
+    } else {
+      struct search_result_t result;
+      search_iterative(&game, depth, NULL, NULL, &result);
+      best_move = result.best_move;
+    }
+    double elapsed = bench_time() - start;
+    allocs = _heap_allocs - allocs;
+    printf("Position %zu: move %02d->%02d, nodes %" PRIu64
+           ", time %.3fs, heap allocations %" PRIu64 "\n",
+           i + 1, best_move.src, best_move.dst, searched_nodes(), elapsed,
+           allocs);
+    total_nodes += searched_nodes();
+    total_allocs += allocs;
+    total_time += elapsed;
+  }
+  printf("Total: nodes %" PRIu64 ", %.0f nodes/s, %.4f heap allocations/node\n",
+         total_nodes, total_nodes / total_time,
+         (double)total_allocs / total_nodes);
+  if (branch_misses >= 0) {
+    misses = read_branch_misses(branch_misses) - misses;
+    printf("Branch misses: %" PRIu64 ", %.1f/node\n", misses,
+           (double)misses / total_nodes);
+    close_branch_misses(branch_misses);
+  } else {
+    printf("Branch misses: performance counters unavailable\n");
+  }
+  return total_time;
+}
+
+// Compare plain iterative deepening with search_iterative()'s aspiration
+// windows and root move ordering.
+int bench_iterative(int depth) {
+  printf("Full windows:\n");
+  _plain_deepening = true;
+  double plain = bench_search(depth, false, false);
+  _plain_deepening = false;
+  printf("search_iterative:\n");
+  double iterative = bench_search(depth, false, false);
+  printf("Speedup %.2fx\n", plain / iterative);
+  return 0;
+}
+
+// Compare full move generation with the incrementally maintained jump graph.
+int bench_jump_graph(int depth) {
+  printf("Full regeneration:\n");
+  double full = bench_search(depth, false, false);
+  printf("Incremental jump graph:\n");
+  double incremental = bench_search(depth, true, false);
+  printf("Speedup %.2fx\n", full / incremental);
+  return 0;
+}
+
+// Search the bench positions with plain and with symmetry-canonical hash keys.
+int bench_canonical(int depth) {
+  printf("Plain keys:\n");
+  double plain = bench_search(depth, false, false);
+  printf("Canonical keys:\n");
+  double canonical = bench_search(depth, false, true);
+  printf("Speedup %.2fx\n", plain / canonical);
+  return 0;
+}
+
+const char *HASH_PAGES_NAMES[] = {"explicit huge pages",
+                                  "transparent huge pages", "normal pages",
+                                  "heap", "none"};
+
+// Search the bench positions with hash tables of 1, 8, 64 ... max_mb MB.
+int bench_hash(int depth, int max_mb) {
+  double times[8];
+  int sizes[8], n = 0;
+  for (int mb = 1; mb <= max_mb && n < 8; mb *= 8) {
+    double start = bench_time();
+    if (!set_hash_mb(mb)) {
+      printf("%d MB: can't allocate\n", mb);
+      break;
+    }
+    double allocated = bench_time() - start;
+    printf("%d MB, %" PRIu64 " entries, %s, allocated in %.6fs:\n", mb,
+           hash_entries(), HASH_PAGES_NAMES[hash_pages()], allocated);
+    times[n] = bench_search(depth, false, false);
+    sizes[n++] = mb;
+  }
+  for (int i = 0; i < n; i++) {
+    printf("%5d MB: time %.3fs\n", sizes[i], times[i]);
+  }
+  return 0;
+}
+
+// Play `moves` moves from the initial position, searching each to `depth`,
+// with the hash table cleared before every move or only aged.
+int bench_generation(int depth, int moves) {
+  for (int aged = 0; aged <= 1; aged++) {
+    struct game_t game;
+    struct search_result_t result;
+    uint64_t nodes = 0;
+    double clearing = 0, start = bench_time();
+    init_game(&game);
+    clear_hash_table();
+    clear_history();
+    for (int m = 0; m < moves && !is_game_over(&game); m++) {
+      double clear_start = bench_time();
+      if (aged) {
+        next_hash_generation();
+      } else {
+        clear_hash_table();
+      }
+      clearing += bench_time() - clear_start;
+      clear_searched_nodes();
+      search_iterative(&game, depth, NULL, NULL, &result);
+      nodes += searched_nodes();
+      game_apply_move(&game, &result.best_move);
+    }
+    printf("%-8s nodes %" PRIu64 ", time %.3fs, of which clearing %.3fs\n",
+           aged ? "Aged:" : "Cleared:", nodes, bench_time() - start, clearing);
+  }
+  return 0;
+}
+
+// Time to reach `depth` in the bench positions with 1, 2, 4 ... max_threads
+// threads working in `mode`.
+int bench_smp(int depth, int max_threads, enum search_mode_t mode) {
+  // powers of two up to MAX_SEARCH_THREADS
+  double times[8];
+  int counts[8], n = 0;
+  // untimed, so that the hash table's first touch and the like don't count
+  // against the 1 thread run alone
+  printf("Warm-up, 1 thread:\n");
+  set_search_threads(1);
+  set_search_mode(mode);
+  bench_search(depth, false, false);
+  for (int threads = 1; threads <= max_threads && threads <= MAX_SEARCH_THREADS;
+       threads *= 2) {
+    printf("%d threads:\n", threads);
+    set_search_threads(threads);
+    set_search_mode(mode);
+    times[n] = bench_search(depth, false, false);
+    counts[n++] = threads;
+  }
+  set_search_threads(1);
+  set_search_mode(SEARCH_LAZY_SMP);
+  for (int i = 0; i < n; i++) {
+    printf("Threads %2d: time %.3fs, speedup %.2fx\n", counts[i], times[i],
+           times[0] / times[i]);
+  }
+  return 0;
+}
+
+// Search each bench position for `seconds` of wall time with `threads`
+// threads, showing how far the deadline is overrun.
+int bench_deadline(double seconds, int threads) {
+  set_search_threads(threads);
+  for (size_t i = 0; i < sizeof(BENCH_POSITIONS) / sizeof(char *); i++) {
+    struct game_t game;
+    struct search_control_t control;
+    struct search_result_t result;
+    load_game(&game, (char *)BENCH_POSITIONS[i]);
+    clear_hash_table();
+    clear_history();
+    init_search_control(&control, seconds);
+    search_iterative(&game, 32, &control, NULL, &result);
+    printf("Position %zu: depth %d, move %02d->%02d, nodes %" PRIu64
+           ", time %.3fs, overrun %.1fms\n",
+           i + 1, result.depth, result.best_move.src, result.best_move.dst,
+           result.searched_nodes, result.seconds,
+           (result.seconds - seconds) * 1e3);
+  }
+  set_search_threads(1);
+  return 0;
+}
+
+// Depth reached in `seconds` per bench position without reductions and
+// pruning, then with `tuning`.
+int bench_selectivity(double seconds, struct search_tuning_t *tuning) {
+  struct search_tuning_t off = {INT_MAX, 0, 0, 0, 0};
+  printf("No reductions or pruning:\n");
+  set_search_tuning(&off);
+  bench_deadline(seconds, 1);
+  printf("Reductions %d/%d/%d, pruning %d/%d:\n", tuning->lmr_depth,
+         tuning->lmr_moves, tuning->lmr_reduction, tuning->sideways_depth,
+         tuning->backward_depth);
+  set_search_tuning(tuning);
+  bench_deadline(seconds, 1);
+  return 0;
+}
+
+// Time gen_moves and game_is_move_valid over the bench positions, returning
+// nanoseconds per position.
+double bench_movegen_impl(int iterations) {
+  struct game_t games[sizeof(BENCH_POSITIONS) / sizeof(char *)];
+  int n = sizeof(BENCH_POSITIONS) / sizeof(char *);
+  struct move_list_t moves;
+  uint64_t checksum = 0;
+  for (int i = 0; i < n; i++) {
+    load_game(&games[i], (char *)BENCH_POSITIONS[i]);
+  }
+  double start = bench_time();
+  for (int k = 0; k < iterations; k++) {
+    for (int i = 0; i < n; i++) {
+      // one side at a time, both together may not fit in a move list
+      for (enum color_t color = PIECE_RED; color <= PIECE_GREEN; color++) {
+        moves.len = 0;
+        gen_moves(&games[i].board, games[i].board.pieces[color], &moves);
+        checksum += moves.len;
+        for (int j = 0; j < moves.len; j += 7) {
+          checksum += game_is_move_valid(&games[i], &moves.moves[j]);
+        }
+      }
+    }
+  }
+  double elapsed = bench_time() - start;
+  if (checksum == 0) {
+    printf("no moves generated\n");
+  }
+  return elapsed * 1e9 / ((double)iterations * n);
+}
+
+int bench_movegen(int iterations) {
+  double generic_ns = 0;
+  for (int impl = MOVEGEN_GENERIC; impl <= MOVEGEN_COMPONENTS; impl++) {
+    if (!set_movegen_impl(impl)) {
+      printf("%-10s unsupported\n", MOVEGEN_NAMES[impl]);
+      continue;
+    }
+    double ns = bench_movegen_impl(iterations);
+    if (impl == MOVEGEN_GENERIC) {
+      generic_ns = ns;
+    }
+    printf("%-10s %8.1f ns/position, speedup %.2fx\n", MOVEGEN_NAMES[impl], ns,
+           generic_ns / ns);
+  }
+  init_movegen();
+  return 0;
+}
+
+const char *BATCH_NAMES[] = {"generic", "avx2", "avx512"};
+
+// Positions from random games, for benchmarks over many unrelated boards.
+int random_positions(struct game_t *games, int n) {
+  struct move_list_t moves;
+  int len = 0;
+  srand(2);
+  while (len < n) {
+    struct game_t game;
+    init_game(&game);
+    for (int ply = 0; ply < 120 && len < n && !is_game_over(&game); ply++) {
+      moves.len = 0;
+      game_gen_moves(&game,
+                     game.turn == PIECE_RED ? game.board.red : game.board.green,
+                     &moves);
+      if (moves.len == 0) {
+        break;
+      }
+      games[len++] = game;
+      game_apply_move(&game, &moves.moves[rand() % moves.len]);
+    }
+  }
+  return len;
+}
+
+// Moves of the side to move for many independent positions: one gen_moves
+// call per position against gen_moves_batch with every vector width.
+int bench_batch(int n) {
+  static struct move_list_t moves[BATCH_SIZE];
+  struct game_t *games = malloc(n * sizeof(struct game_t));
+  uint64_t checksum = 0;
+  double start, scalar_ns;
+  n = random_positions(games, n);
+  start = bench_time();
+  for (int k = 0; k < 20; k++) {
+    for (int i = 0; i < n; i++) {
+      moves[0].len = 0;
+      checksum += gen_moves(&games[i].board,
+                            games[i].turn == PIECE_RED ? games[i].board.red
+                                                       : games[i].board.green,
+                            &moves[0]);
+    }
+  }
+  scalar_ns = (bench_time() - start) * 1e9 / (20.0 * n);
+  printf("%-10s %8.1f ns/position\n", "gen_moves", scalar_ns);
+  for (int impl = BATCH_GENERIC; impl <= BATCH_AVX512; impl++) {
+    if (!set_batch_impl(impl)) {
+      printf("%-10s unsupported\n", BATCH_NAMES[impl]);
+      continue;
+    }
+    start = bench_time();
+    for (int k = 0; k < 20; k++) {
+      for (int i = 0; i < n; i += BATCH_SIZE) {
+        struct board_batch_t batch = {0};
+        for (int j = i; j < n && j < i + BATCH_SIZE; j++) {
+          batch_add_board(&batch, &games[j].board, games[j].turn);
+          moves[j - i].len = 0;
+        }
+        checksum += gen_moves_batch(&batch, moves);
+      }
+    }
+    double ns = (bench_time() - start) * 1e9 / (20.0 * n);
+    printf("%-10s %8.1f ns/position, speedup %.2fx\n", BATCH_NAMES[impl], ns,
+           scalar_ns / ns);
+  }
+  if (checksum == 0) {
+    printf("no moves generated\n");
+  }
+  init_movegen();
+  free(games);
+  return 0;
+}
+
+// Round trip of many positions through the text format and through the packed
+// records.
+int bench_codec(int n) {
+  struct game_t *games = malloc(n * sizeof(struct game_t));
+  struct packed_game_t *packed = malloc(n * sizeof(struct packed_game_t));
+  char(*text)[128] = malloc(n * sizeof(*text));
+  uint64_t checksum = 0, text_bytes = 0;
+  double start, text_ns, packed_ns;
+  n = random_positions(games, n);
+  start = bench_time();
+  for (int k = 0; k < 20; k++) {
+    for (int i = 0; i < n; i++) {
+      struct game_t game;
+      game_str(&games[i], text[i]);
+      load_game(&game, text[i]);
+      checksum += game.hash;
+    }
+  }
+  text_ns = (bench_time() - start) * 1e9 / (20.0 * n);
+  start = bench_time();
+  for (int k = 0; k < 20; k++) {
+    for (int i = 0; i < n; i++) {
+      struct game_t game;
+      game_pack(&games[i], &packed[i]);
+      game_unpack(&game, &packed[i]);
+      checksum -= game.hash;
+    }
+  }
+  packed_ns = (bench_time() - start) * 1e9 / (20.0 * n);
+  for (int i = 0; i < n; i++) {
+    text_bytes += strlen(text[i]) + 1;
+  }
+  printf("text    %8.1f ns/position, %5.1f bytes/position\n", text_ns,
+         (double)text_bytes / n);
+  printf("packed  %8.1f ns/position, %5.1f bytes/position, speedup %.2fx\n",
+         packed_ns, (double)PACKED_GAME_SIZE, text_ns / packed_ns);
+  if (checksum != 0) {
+    printf("packed positions differ from the text ones\n");
+  }
+  free(games);
+  free(packed);
+  free(text);
+  return checksum != 0;
+}
+
+// Convert a file of game_str lines to packed records, or back.
+int convert_games(bool pack, const char *in_path, const char *out_path) {
+  FILE *in = fopen(in_path, "rb"), *out = fopen(out_path, "wb");
+  struct packed_game_t packed;
+  struct game_t game;
+  char line[256];
+  int count = 0, skipped = 0;
+  if (in == NULL || out == NULL) {
+    printf("Can't open %s\n", in == NULL ? in_path : out_path);
+    return 1;
+  }
+  if (pack) {
+    while (fgets(line, sizeof(line), in) != NULL) {
+      if (line[0] == '\n' || line[0] == '#') {
+        continue;
+      }
+      load_game(&game, line);
+      if (!game_pack(&game, &packed)) {
+        skipped++;
+        continue;
+      }
+      fwrite(&packed, sizeof(packed), 1, out);
+      count++;
+    }
+  } else {
+    while (fread(&packed, sizeof(packed), 1, in) == 1) {
+      if (!game_unpack(&game, &packed)) {
+        skipped++;
+        continue;
+      }
+      game_str(&game, line);
+      fprintf(out, "%s\n", line);
+      count++;
+    }
+  }
+  printf("Converted %d positions, skipped %d\n", count, skipped);
+  fclose(in);
+  fclose(out);
+  return skipped != 0;
+}
+
+// Destination sets of every piece of the side to move, plus the number of
+// (src, dst) pairs game_is_move_valid accepts.
+int movegen_dests(struct game_t *game, uint128_t dests[81]) {
+  struct move_list_t moves;
+  int valid = 0;
+  moves.len = 0;
+  game_gen_moves(game,
+                 game->turn == PIECE_RED ? game->board.red : game->board.green,
+                 &moves);
+  for (int i = 0; i < 81; i++) {
+    dests[i] = 0;
+  }
+  for (int i = 0; i < moves.len; i++) {
+    dests[moves.moves[i].src] |= MASK_AT(moves.moves[i].dst);
+  }
+  for (int src = 0; src < 81; src++) {
+    for (int dst = 0; dst < 81; dst++) {
+      struct move_t move = {.src = src, .dst = dst};
+      valid += game_is_move_valid(game, &move);
+    }
+  }
+  return valid;
+}
+
+// Compare gen_moves_batch with every batch implementation against gen_moves.
+int check_batch(struct game_t *games, int n) {
+  static struct move_list_t expected[BATCH_SIZE], actual[BATCH_SIZE];
+  struct board_batch_t batch = {0};
+  int errors = 0;
+  for (int i = 0; i < n; i++) {
+    batch_add_board(&batch, &games[i].board, games[i].turn);
+    expected[i].len = 0;
+    gen_moves(&games[i].board,
+              games[i].turn == PIECE_RED ? games[i].board.red
+                                         : games[i].board.green,
+              &expected[i]);
+  }
+  for (int impl = BATCH_GENERIC; impl <= BATCH_AVX512; impl++) {
+    if (!set_batch_impl(impl)) {
+      continue;
+    }
+    for (int i = 0; i < n; i++) {
+      actual[i].len = 0;
+    }
+    gen_moves_batch(&batch, actual);
+    for (int i = 0; i < n; i++) {
+      if (actual[i].len != expected[i].len ||
+          memcmp(actual[i].moves, expected[i].moves,
+                 expected[i].len * sizeof(struct move_t)) != 0) {
+        char str[128];
+        game_str(&games[i], str);
+        printf("batch %s mismatch: %s\n", BATCH_NAMES[impl], str);
+        errors++;
+      }
+    }
+  }
+  init_movegen();
+  return errors;
+}
+
+// Play random games and compare every move generator, and the incrementally
+// maintained jump graph, against the generic generator.
+int check_movegen(int games) {
+  uint128_t expected[81], actual[81];
+  struct jump_graph_t graph, fresh_graph;
+  struct move_list_t moves;
+  struct game_t batch_games[BATCH_SIZE];
+  int positions = 0, errors = 0, batched = 0, batch_len = 1;
+  srand(1);
+  for (int g = 0; g < games; g++) {
+    struct game_t game, graph_game;
+    init_game(&game);
+    game_set_symmetric(&game, true);
+    init_game(&graph_game);
+    game_attach_jump_graph(&graph_game, &graph);
+    for (int ply = 0; ply < 200 && !is_game_over(&game); ply++) {
+      set_movegen_impl(MOVEGEN_GENERIC);
+      int valid = movegen_dests(&game, expected);
+      for (int impl = MOVEGEN_BMI2; impl <= MOVEGEN_COMPONENTS; impl++) {
+        if (!set_movegen_impl(impl)) {
+          continue;
+        }
+        if (movegen_dests(&game, actual) != valid ||
+            memcmp(expected, actual, sizeof(expected)) != 0) {
+          char str[128];
+          game_str(&game, str);
+          printf("%s mismatch: %s\n", MOVEGEN_NAMES[impl], str);
+          errors++;
+        }
+      }
+      set_movegen_impl(MOVEGEN_GENERIC);
+      struct game_t fresh_game = game;
+      game_attach_jump_graph(&fresh_game, &fresh_graph);
+      if (memcmp(&graph, &fresh_graph, sizeof(graph)) != 0 ||
+          movegen_dests(&graph_game, actual) != valid ||
+          memcmp(expected, actual, sizeof(expected)) != 0) {
+        char str[128];
+        game_str(&game, str);
+        printf("jump graph mismatch: %s\n", str);
+        errors++;
+      }
+      // the lazily filled cache must agree with game_is_move_valid
+      struct reach_cache_t reach = {0};
+      int reachable = 0;
+      for (int src = 0; src < 81; src++) {
+        for (int dst = 0; dst < 81; dst++) {
+          struct move_t move = {.src = src, .dst = dst};
+          reachable += game_is_move_reachable(&game, &reach, &move);
+        }
+      }
+      if (reachable != valid) {
+        char str[128];
+        game_str(&game, str);
+        printf("reach cache mismatch: %s\n", str);
+        errors++;
+      }
+      moves.len = 0;
+      gen_moves(&game.board,
+                game.turn == PIECE_RED ? game.board.red : game.board.green,
+                &moves);
+      if (moves.len == 0) {
+        break;
+      }
+      // every move gets a hop path that replays to its destination
+      for (int i = 0; i < moves.len; i++) {
+        struct move_t path_move = moves.moves[i];
+        int8_t squares[MAX_PATH_HOPS + 1];
+        int n = game_find_move_path(&game, &path_move)
+                    ? move_squares(&path_move, squares)
+                    : 0;
+        if (n < 2 || squares[n - 1] != path_move.dst ||
+            !game_is_move_valid(&game, &path_move)) {
+          char str[128];
+          game_str(&game, str);
+          printf("path mismatch %02d->%02d: %s\n", path_move.src,
+                 path_move.dst, str);
+          errors++;
+        }
+      }
+      // the mirror images of the position: incrementally kept keys, the
+      // evaluation and the mapped moves with their paths must all agree
+      for (int sym = 1; sym < 4; sym++) {
+        struct game_t mirror;
+        bool mapped = true;
+        symmetric_game(sym, &game, &mirror);
+        for (int i = 0; i < moves.len; i++) {
+          struct move_t sym_move = moves.moves[i];
+          game_find_move_path(&game, &sym_move);
+          symmetric_move(sym, &sym_move);
+          mapped = mapped && game_is_move_valid(&mirror, &sym_move);
+        }
+        if (mirror.hash != game.sym_hash[sym - 1] ||
+            game_evaluate(&mirror) != game_evaluate(&game) || !mapped) {
+          char str[128];
+          game_str(&game, str);
+          printf("symmetry %d mismatch: %s\n", sym, str);
+          errors++;
+        }
+      }
+      // the packed record must give back the same position
+      struct packed_game_t packed;
+      struct game_t unpacked;
+      if (!game_pack(&game, &packed) || !game_unpack(&unpacked, &packed) ||
+          unpacked.board.red != game.board.red ||
+          unpacked.board.green != game.board.green ||
+          unpacked.turn != game.turn || unpacked.round != game.round ||
+          unpacked.hash != game.hash) {
+        char str[128];
+        game_str(&game, str);
+        printf("pack mismatch: %s\n", str);
+        errors++;
+      }
+      // batches of 1 to BATCH_SIZE boards from the games so far
+      batch_games[batched++] = game;
+      if (batched == batch_len) {
+        errors += check_batch(batch_games, batched);
+        batch_len = batch_len % BATCH_SIZE + 1;
+        batched = 0;
+      }
+      struct move_t move = moves.moves[rand() % moves.len];
+      game_apply_move(&game, &move);
+      // the incrementally updated graph must match one built from scratch,
+      // also after undoing and redoing the move
+      game_apply_move(&graph_game, &move);
+      game_undo_move(&graph_game, &move);
+      game_apply_move(&graph_game, &move);
+      positions++;
+    }
+  }
+  init_movegen();
+  printf("Checked %d positions, %d mismatches\n", positions, errors);
+  return errors != 0;
+}
+
+int main(int argc, char *argv[]) {
+  struct move_list_t moves = {0};
   init_zobrist();
+  init_movegen();
+  if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+    bench_search(argc >= 3 ? atoi(argv[2]) : 7, false, false);
+    return 0;
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-canonical") == 0) {
+    return bench_canonical(argc >= 3 ? atoi(argv[2]) : 8);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-iterative") == 0) {
+    return bench_iterative(argc >= 3 ? atoi(argv[2]) : 8);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-deadline") == 0) {
+    return bench_deadline(argc >= 3 ? atof(argv[2]) : 1,
+                          argc >= 4 ? atoi(argv[3]) : 1);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-selectivity") == 0) {
+    // tuning fields in order, the defaults where not given
+    struct search_tuning_t tuning = search_tuning();
+    int *fields[] = {&tuning.lmr_depth, &tuning.lmr_moves,
+                     &tuning.lmr_reduction, &tuning.sideways_depth,
+                     &tuning.backward_depth};
+    for (int i = 0; i < 5 && i + 3 < argc; i++) {
+      *fields[i] = atoi(argv[i + 3]);
+    }
+    return bench_selectivity(argc >= 3 ? atof(argv[2]) : 1, &tuning);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-smp") == 0) {
+    return bench_smp(argc >= 3 ? atoi(argv[2]) : 8,
+                     argc >= 4 ? atoi(argv[3]) : 32, SEARCH_LAZY_SMP);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-split") == 0) {
+    return bench_smp(argc >= 3 ? atoi(argv[2]) : 8,
+                     argc >= 4 ? atoi(argv[3]) : 32, SEARCH_SPLIT);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-hash") == 0) {
+    return bench_hash(argc >= 3 ? atoi(argv[2]) : 7,
+                      argc >= 4 ? atoi(argv[3]) : 512);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-generation") == 0) {
+    return bench_generation(argc >= 3 ? atoi(argv[2]) : 7,
+                            argc >= 4 ? atoi(argv[3]) : 16);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-graph") == 0) {
+    return bench_jump_graph(argc >= 3 ? atoi(argv[2]) : 8);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-batch") == 0) {
+    return bench_batch(argc >= 3 ? atoi(argv[2]) : 4096);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-codec") == 0) {
+    return bench_codec(argc >= 3 ? atoi(argv[2]) : 4096);
+  }
+  if (argc >= 4 && (strcmp(argv[1], "pack") == 0 ||
+                    strcmp(argv[1], "unpack") == 0)) {
+    return convert_games(strcmp(argv[1], "pack") == 0, argv[2], argv[3]);
+  }
+  if (argc >= 2 && strcmp(argv[1], "bench-movegen") == 0) {
+    return bench_movegen(argc >= 3 ? atoi(argv[2]) : 200000);
+  }
+  if (argc >= 2 && strcmp(argv[1], "check-movegen") == 0) {
+    return check_movegen(argc >= 3 ? atoi(argv[2]) : 20);
+  }
   struct game_t game;
   load_game(&game, "222200000/222000000/220000000/020000000/000000000/000000011/000000011/000000110/000001111 g 2");
   // init_game(&game);
@@ -85,7 +809,7 @@ int main(void) {
   draw_board(&game.board);
   for (int src = 0; src <= 80; src++) {
     for (int dst = 0; dst <= 80; dst++) {
-      if (game_is_move_valid(&game, &(struct move_t){src, dst})) {
+      if (game_is_move_valid(&game, &(struct move_t){.src = src, .dst = dst})) {
         printf("Move: %02d->%02d\n", src, dst);
       }
     }
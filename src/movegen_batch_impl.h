@@ -0,0 +1,119 @@
+// Batched set-wise move generation, BATCH_LANES boards per vector. checkers.c
+// includes this file once per vector width, with these macros defined:
+//   BATCH(name)     name of the generated function or type
+//   BATCH_TARGET    function attributes, e.g. the target ISA
+//   BATCH_LANES     boards per vector
+//   BATCH_ANY(v)    whether any lane of the vector v is non-zero
+//
+// Every lane holds the same half of a different board, so one vector shift or
+// mask advances the set-wise flood of all of them at once.
+
+typedef uint64_t BATCH(vec_t) __attribute__((vector_size(BATCH_LANES * 8)));
+
+struct BATCH(pair_t) {
+  BATCH(vec_t) lo, hi;
+};
+
+#define BATCH_INLINE BATCH_TARGET static inline __attribute__((always_inline))
+#define BATCH_JUMP(shift, from, all, n) \
+  BATCH(shift)(BATCH(and)(BATCH(shift)(from, n), all), n)
+
+BATCH_INLINE struct BATCH(pair_t) BATCH(shl)(struct BATCH(pair_t) b, int n) {
+  return (struct BATCH(pair_t)){b.lo << n, b.hi << n | b.lo >> (64 - n)};
+}
+
+BATCH_INLINE struct BATCH(pair_t) BATCH(shr)(struct BATCH(pair_t) b, int n) {
+  return (struct BATCH(pair_t)){b.lo >> n | b.hi << (64 - n), b.hi >> n};
+}
+
+BATCH_INLINE struct BATCH(pair_t) BATCH(and)(struct BATCH(pair_t) a,
+                                             struct BATCH(pair_t) b) {
+  return (struct BATCH(pair_t)){a.lo & b.lo, a.hi & b.hi};
+}
+
+BATCH_INLINE struct BATCH(pair_t) BATCH(or)(struct BATCH(pair_t) a,
+                                            struct BATCH(pair_t) b) {
+  return (struct BATCH(pair_t)){a.lo | b.lo, a.hi | b.hi};
+}
+
+BATCH_INLINE struct BATCH(pair_t) BATCH(andnot)(struct BATCH(pair_t) a,
+                                                struct BATCH(pair_t) b) {
+  return (struct BATCH(pair_t)){a.lo & ~b.lo, a.hi & ~b.hi};
+}
+
+BATCH_INLINE struct BATCH(pair_t) BATCH(mask)(uint128_t mask) {
+  return (struct BATCH(pair_t)){(BATCH(vec_t)){} + (uint64_t)mask,
+                                (BATCH(vec_t)){} + (uint64_t)(mask >> 64)};
+}
+
+// Same as jump_step, lane by lane.
+BATCH_INLINE struct BATCH(pair_t) BATCH(jump_step)(struct BATCH(pair_t) from,
+                                                   struct BATCH(pair_t) all) {
+  struct BATCH(pair_t) right = BATCH(and)(from, BATCH(mask)(COLS_0_6));
+  struct BATCH(pair_t) left = BATCH(and)(from, BATCH(mask)(COLS_2_8));
+  struct BATCH(pair_t) to = BATCH(or)(BATCH_JUMP(shl, right, all, 1),
+                                      BATCH_JUMP(shr, left, all, 1));
+  to = BATCH(or)(to, BATCH(or)(BATCH_JUMP(shl, from, all, 9),
+                               BATCH_JUMP(shr, from, all, 9)));
+  to = BATCH(or)(to, BATCH(or)(BATCH_JUMP(shl, left, all, 8),
+                               BATCH_JUMP(shr, right, all, 8)));
+  return BATCH(andnot)(BATCH(and)(to, BATCH(mask)(BOARD_MASK)), all);
+}
+
+// Neighbours of every square in `from`.
+BATCH_INLINE struct BATCH(pair_t) BATCH(adjacent)(struct BATCH(pair_t) from) {
+  struct BATCH(pair_t) right = BATCH(and)(from, BATCH(mask)(COLS_0_7));
+  struct BATCH(pair_t) left = BATCH(and)(from, BATCH(mask)(COLS_1_8));
+  struct BATCH(pair_t) to =
+      BATCH(or)(BATCH(shl)(right, 1), BATCH(shr)(left, 1));
+  to = BATCH(or)(to, BATCH(or)(BATCH(shl)(from, 9), BATCH(shr)(from, 9)));
+  to = BATCH(or)(to, BATCH(or)(BATCH(shl)(left, 8), BATCH(shr)(right, 8)));
+  return BATCH(and)(to, BATCH(mask)(BOARD_MASK));
+}
+
+// Destinations of every piece of the side to move in boards first ..
+// first + BATCH_LANES - 1 of the batch, indexed by source square as in
+// gen_dests.
+BATCH_TARGET static void BATCH(gen_dests_batch)(struct board_batch_t *batch,
+                                                int first,
+                                                uint128_t (*dests)[81]) {
+  typedef BATCH(vec_t) vec_t;
+  typedef struct BATCH(pair_t) pair_t;
+  pair_t red, green, all, empty, from;
+  vec_t turn;
+  __builtin_memcpy(&red.lo, &batch->red[0][first], sizeof(vec_t));
+  __builtin_memcpy(&red.hi, &batch->red[1][first], sizeof(vec_t));
+  __builtin_memcpy(&green.lo, &batch->green[0][first], sizeof(vec_t));
+  __builtin_memcpy(&green.hi, &batch->green[1][first], sizeof(vec_t));
+  __builtin_memcpy(&turn, &batch->turn[first], sizeof(vec_t));
+  all = BATCH(or)(red, green);
+  empty = BATCH(andnot)(BATCH(mask)(BOARD_MASK), all);
+  // all ones in the lanes where green is to move
+  turn = -turn;
+  from.lo = (red.lo & ~turn) | (green.lo & turn);
+  from.hi = (red.hi & ~turn) | (green.hi & turn);
+  while (BATCH_ANY(from.lo | from.hi)) {
+    // the lowest remaining piece of every board
+    pair_t square, reach, frontier, to;
+    square.lo = from.lo & -from.lo;
+    square.hi = from.hi & -from.hi & (vec_t)(from.lo == 0);
+    from = BATCH(andnot)(from, square);
+    to = BATCH(and)(BATCH(adjacent)(square), empty);
+    reach = frontier = square;
+    while (BATCH_ANY(frontier.lo | frontier.hi)) {
+      frontier = BATCH(andnot)(BATCH(jump_step)(frontier, all), reach);
+      reach = BATCH(or)(reach, frontier);
+    }
+    to = BATCH(or)(to, BATCH(andnot)(reach, square));
+    for (int i = 0; i < BATCH_LANES; i++) {
+      if (square.lo[i] | square.hi[i]) {
+        int src = square.lo[i] ? __builtin_ctzll(square.lo[i])
+                               : 64 + __builtin_ctzll(square.hi[i]);
+        dests[first + i][src] = (uint128_t)to.hi[i] << 64 | to.lo[i];
+      }
+    }
+  }
+}
+
+#undef BATCH_INLINE
+#undef BATCH_JUMP
@@ -0,0 +1,80 @@
+// Move generation kernels. checkers.c includes this file once per jump table
+// index implementation, with these macros defined:
+//   MOVEGEN(name)       name of the generated function
+//   MOVEGEN_TARGET      function attributes, e.g. the target ISA
+//   JUMP_INDEX(p, adj)  6-bit jump index (see hash_adj) of the occupied
+//                       neighbours `adj` of square p
+// The kernels stay on uint128_t: each hop indexes the tables with variable
+// 128-bit shifts, and a bitboard_t would cross between SSE and general
+// registers every time.
+
+MOVEGEN_TARGET static void MOVEGEN(gen_dests)(struct board_t *board,
+                                            uint128_t from, uint128_t *dests) {
+  int src, dst;
+  uint128_t all = board->red | board->green;
+  u128_for_each_1(from, src) {
+    uint128_t to = 0;
+    uint128_t adj = ADJ_POSITIONS[src];
+    to |= adj;
+    to &= ~all & BOARD_MASK;
+
+    uint128_t jump_to = 0, prev_jump_to = MASK_AT(src), jumps;
+    while ((prev_jump_to | jump_to) != jump_to) {
+      jump_to |= prev_jump_to;
+      jumps = 0;
+      u128_for_each_1(prev_jump_to, dst) {
+        adj = ADJ_POSITIONS[dst] & all;
+        jumps |= jump_landings(dst, JUMP_INDEX(dst, adj)) & BOARD_MASK;
+      }
+      prev_jump_to = jumps & ~all;
+    }
+    jump_to &= ~MASK_AT(src);
+    dests[src] = to | jump_to;
+  }
+}
+
+MOVEGEN_TARGET static void MOVEGEN(jump_moves)(struct board_t *board, int src,
+                                             uint128_t *to) {
+  uint128_t adj = ADJ_POSITIONS[src] & (board->red | board->green);
+  uint128_t jumps = jump_landings(src, JUMP_INDEX(src, adj)) & BOARD_MASK;
+  jumps &= ~(board->red | board->green);
+  if ((jumps | *to) == *to) {
+    // no more jumps
+    return;
+  }
+  *to |= jumps;
+  u128_for_each_1(jumps, src) { MOVEGEN(jump_moves)(board, src, to); }
+  return;
+}
+
+MOVEGEN_TARGET static bool MOVEGEN(game_is_move_valid)(struct game_t *game,
+                                                     struct move_t *move) {
+  uint128_t all = game->board.red | game->board.green;
+  int to;
+  if (u128_test(all, move->dst) || !u128_test(all, move->src)) {
+    return false;
+  }
+  if (u128_test(game->board.pieces[opponent(game->turn)], move->src)) {
+    return false;
+  }
+  // check for adjacent moves
+  if (u128_test(ADJ_POSITIONS[move->src], move->dst)) {
+    return true;
+  }
+  // check for jumps
+  uint128_t jump_to = 0, prev_jump_to = MASK_AT(move->src), jumps = 0;
+  uint128_t adj;
+  while ((prev_jump_to | jump_to) != jump_to) {
+    jump_to |= prev_jump_to;
+    jumps = 0;
+    u128_for_each_1(prev_jump_to, to) {
+      adj = ADJ_POSITIONS[to] & all;
+      jumps |= jump_landings(to, JUMP_INDEX(to, adj)) & BOARD_MASK;
+      if (u128_test(jumps, move->dst)) {
+        return true;
+      }
+    }
+    prev_jump_to = jumps & ~all;
+  }
+  return false;
+}
@@ -0,0 +1,219 @@
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "checkers.h"
+
+#define MAX_DEPTH 32
+#define MAX_THREADS 256
+
+/**
+ * Subtotal of a position at a given depth. `check` is the position key xor
+ * the count, so a torn write by another thread fails the lookup instead of
+ * returning a wrong count.
+ */
+struct perft_entry_t {
+  uint64_t check;
+  uint64_t count;
+};
+
+struct perft_worker_t {
+  pthread_t thread;
+  struct game_t game;
+  struct move_list_t *lists;
+};
+
+struct perft_entry_t *_perft_table = NULL;
+uint64_t _perft_mask = 0;
+uint64_t _depth_keys[MAX_DEPTH + 1];
+
+struct game_t _root;
+struct move_list_t _root_moves;
+uint64_t _root_counts[MAX_MOVES];
+atomic_int _next_root_move;
+int _depth;
+
+static double perft_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool perft_probe(uint64_t key, uint64_t *count) {
+  struct perft_entry_t *entry = &_perft_table[key & _perft_mask];
+  uint64_t check = atomic_load_explicit((_Atomic uint64_t *)&entry->check,
+                                        memory_order_relaxed);
+  uint64_t value = atomic_load_explicit((_Atomic uint64_t *)&entry->count,
+                                        memory_order_relaxed);
+  if ((check ^ value) != key) {
+    return false;
+  }
+  *count = value;
+  return true;
+}
+
+static void perft_store(uint64_t key, uint64_t count) {
+  struct perft_entry_t *entry = &_perft_table[key & _perft_mask];
+  atomic_store_explicit((_Atomic uint64_t *)&entry->check, key ^ count,
+                        memory_order_relaxed);
+  atomic_store_explicit((_Atomic uint64_t *)&entry->count, count,
+                        memory_order_relaxed);
+}
+
+// Leaves at `depth` plies below the position. Finished games have none, and
+// the last ply is counted on destination bitboards without emitting moves.
+static uint64_t perft(struct game_t *game, int depth,
+                      struct move_list_t *lists) {
+  uint128_t from = game->board.pieces[game->turn];
+  uint64_t count = 0, key = game->hash ^ _depth_keys[depth];
+  int src;
+  if (is_game_over(game)) {
+    return 0;
+  }
+  if (depth == 1) {
+    uint128_t dests[81];
+    game_gen_dests(game, from, dests);
+    u128_for_each_1(from, src) { count += popcount_u128(dests[src]); }
+    return count;
+  }
+  if (_perft_table != NULL && perft_probe(key, &count)) {
+    return count;
+  }
+  struct move_list_t *moves = &lists[depth];
+  moves->len = 0;
+  game_gen_moves(game, from, moves);
+  for (int i = 0; i < moves->len; i++) {
+    game_apply_move(game, &moves->moves[i]);
+    count += perft(game, depth - 1, lists);
+    game_undo_move(game, &moves->moves[i]);
+  }
+  if (_perft_table != NULL) {
+    perft_store(key, count);
+  }
+  return count;
+}
+
+// Take root moves off the shared counter until none are left.
+static void *perft_worker(void *arg) {
+  struct perft_worker_t *worker = arg;
+  int i;
+  while ((i = atomic_fetch_add(&_next_root_move, 1)) < _root_moves.len) {
+    struct move_t *move = &_root_moves.moves[i];
+    game_apply_move(&worker->game, move);
+    _root_counts[i] =
+        _depth == 1 ? 1 : perft(&worker->game, _depth - 1, worker->lists);
+    game_undo_move(&worker->game, move);
+  }
+  return NULL;
+}
+
+static void usage(char *name) {
+  printf("Usage: %s [-d] [-t threads] [-H hash_mb] [-m movegen] depth "
+         "[position]\n",
+         name);
+  printf("  -d          print the leaf count below every root move\n");
+  printf("  -t threads  split the root moves over this many threads\n");
+  printf("  -H hash_mb  cache subtotals in a table of this many MB\n");
+  printf("  -m movegen  generic, bmi2, setwise or components\n");
+  printf("  position    as printed by game_str, the initial one by default\n");
+}
+
+int main(int argc, char *argv[]) {
+  static const char *movegen_names[] = {"generic", "bmi2", "setwise",
+                                        "components"};
+  bool divide = false;
+  int threads = 1, hash_mb = 0, i;
+  init_zobrist();
+  init_movegen();
+  for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+    if (strcmp(argv[i], "-d") == 0) {
+      divide = true;
+    } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-H") == 0 && i + 1 < argc) {
+      hash_mb = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+      int impl = 0;
+      i++;
+      while (impl < 4 && strcmp(argv[i], movegen_names[impl]) != 0) {
+        impl++;
+      }
+      if (impl == 4 || !set_movegen_impl(impl)) {
+        printf("Unsupported move generator: %s\n", argv[i]);
+        return 1;
+      }
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (i >= argc || (_depth = atoi(argv[i])) < 1 || _depth > MAX_DEPTH ||
+      threads < 1 || threads > MAX_THREADS || hash_mb < 0) {
+    usage(argv[0]);
+    return 1;
+  }
+  if (i + 1 < argc) {
+    // the position may come as one argument or split at its spaces
+    char state[256] = "";
+    for (int j = i + 1; j < argc; j++) {
+      strncat(state, argv[j], sizeof(state) - strlen(state) - 2);
+      strcat(state, " ");
+    }
+    load_game(&_root, state);
+  } else {
+    init_game(&_root);
+  }
+
+  if (hash_mb > 0) {
+    uint64_t entries = 1;
+    while (entries * 2 * sizeof(struct perft_entry_t) <=
+           (uint64_t)hash_mb << 20) {
+      entries *= 2;
+    }
+    _perft_table = calloc(entries, sizeof(struct perft_entry_t));
+    _perft_mask = entries - 1;
+    srand(7);
+    for (int d = 0; d <= MAX_DEPTH; d++) {
+      _depth_keys[d] = (uint64_t)rand() << 42 ^ (uint64_t)rand() << 21 ^ rand();
+    }
+  }
+
+  _root_moves.len = 0;
+  if (!is_game_over(&_root)) {
+    game_gen_moves(&_root, _root.board.pieces[_root.turn], &_root_moves);
+  }
+  atomic_init(&_next_root_move, 0);
+  struct perft_worker_t *workers = calloc(threads, sizeof(*workers));
+  double start = perft_time();
+  for (int t = 0; t < threads; t++) {
+    workers[t].game = _root;
+    workers[t].lists = malloc((MAX_DEPTH + 1) * sizeof(struct move_list_t));
+    pthread_create(&workers[t].thread, NULL, perft_worker, &workers[t]);
+  }
+  for (int t = 0; t < threads; t++) {
+    pthread_join(workers[t].thread, NULL);
+    free(workers[t].lists);
+  }
+  double elapsed = perft_time() - start;
+
+  uint64_t total = 0;
+  for (int m = 0; m < _root_moves.len; m++) {
+    if (divide) {
+      char str[64];
+      move_str(&_root_moves.moves[m], str);
+      printf("%s: %" PRIu64 "\n", str, _root_counts[m]);
+    }
+    total += _root_counts[m];
+  }
+  printf("Depth %d: %" PRIu64 " leaves, %d root moves, %.3fs, %.0f leaves/s\n",
+         _depth, total, _root_moves.len, elapsed,
+         elapsed > 0 ? total / elapsed : 0);
+  free(workers);
+  free(_perft_table);
+  return 0;
+}
@@ -1,56 +1,658 @@
 #include "search.h"
 
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdio.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
-#include "list.h"
-
-#define forward_distance(color, src, dst)                             \
-  (color == PIECE_GREEN ? BOARD_DISTANCES[dst] - BOARD_DISTANCES[src] \
-                        : BOARD_DISTANCES[src] - BOARD_DISTANCES[dst])
-
-#define free_moves(moves)                          \
-  do {                                             \
-    list_for_each_safe(pos, _n, moves) {           \
-      move = list_entry(pos, struct move_t, list); \
-      list_del(pos);                               \
-      free(move);                                  \
-    }                                              \
-  } while (0)
-#define is_forwards(color, src, dst) \
-  ((color == PIECE_RED && src >= dst) || (color == PIECE_GREEN && src <= dst))
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 #define NULL_MOVE_R 3
-#define TABLE_SIZE (1 << 22)
-#define TABLE_MASK ((1 << 22) - 1)
+// Hash table size until set_hash_mb() or set_hash_entries() says otherwise.
+#define DEFAULT_HASH_MB 128
+#define HUGE_PAGE_SIZE (2 << 20)
 #define MAX_DEPTH 64
+// Shallowest node whose moves are shared with idle threads in SEARCH_SPLIT
+// mode, below it a split costs more than the subtrees it hands out.
+#define SPLIT_MIN_DEPTH 4
+// Bound of the history scores, which an update moves towards in proportion to
+// how far they still are from it.
+#define HISTORY_MAX 16384
+// search_iterative(): first iteration searched in an aspiration window, and
+// the window's half width, which grows 4 times per failure until it passes
+// ASPIRATION_MAX_WINDOW and the failing side opens up completely.
+#define ASPIRATION_MIN_DEPTH 3
+#define ASPIRATION_WINDOW 100
+#define ASPIRATION_MAX_WINDOW 2000
+
+#define same_move(a, b) ((a).src == (b).src && (a).dst == (b).dst)
+
+enum pick_stage_t {
+  PICK_HASH,
+  PICK_KILLERS,
+  PICK_GEN_JUMPS,
+  PICK_JUMPS,
+  PICK_GEN_REST,
+  PICK_REST,
+};
+
+/**
+ * Staged move picker: the hash move, then the killer moves and the counter
+ * move, then forward jumps best first, then everything else by distance and
+ * history. Each stage is only generated once the previous ones failed to cut
+ * off, and moves are picked by partial selection sort instead of sorting the
+ * whole list.
+ */
+struct move_picker_t {
+  enum pick_stage_t stage;
+  enum color_t color;
+  struct move_t tried[4];
+  int tried_len;
+  // the two killers, then the counter move
+  struct move_t killers[3];
+  int killer_index;
+  int (*history)[81];
+  uint128_t from;
+  struct reach_cache_t reach;
+  struct move_list_t moves;
+  int scores[MAX_MOVES];
+  int index;
+};
+
+struct split_point_t;
+
+/**
+ * State of one search thread. Lazy SMP threads share only the hash table;
+ * killers, history, move pickers and node counts are their own.
+ */
+struct search_thread_t {
+  struct move_t killer_moves[MAX_DEPTH][2];
+  // butterfly history: cutoffs of every src -> dst, weighted by depth
+  int history[81][81];
+  // the move that last cut off in reply to every opponent src -> dst, all
+  // zero (src == dst) where there is none yet
+  struct move_t counter_moves[81][81];
+  // the move that led to the node being entered, src -1 after a null move
+  struct move_t last_move;
+  // Move pickers indexed by remaining depth, which strictly decreases along
+  // every search path, so a child never reuses its parent's picker.
+  struct move_picker_t move_pickers[MAX_DEPTH];
+  uint64_t searched_nodes;
+  // helpers drop their search, without storing anything, once told to stop
+  bool helper;
+  int index;
+  pthread_t thread;
+  struct game_t game;
+  // SEARCH_SPLIT: the innermost split point the thread searches moves of, a
+  // cutoff there or further up abandons the thread's subtree
+  struct split_point_t *split;
+};
+
+/**
+ * A node whose remaining moves are shared between the thread that searched
+ * its first move (the master) and any thread that joins it, as in Young
+ * Brothers Wait. While moves remain it is on the list of open split points,
+ * where idle threads find it. Moves come from the master's picker and the
+ * bounds are updated under `lock`. A beta cutoff by any thread sets
+ * `cutoff`, which stops the others.
+ */
+struct split_point_t {
+  pthread_mutex_t lock;
+  struct split_point_t *parent;
+  // next on the list of open split points
+  struct split_point_t *next;
+  struct game_t game;
+  struct move_picker_t *picker;
+  int depth;
+  // moves taken from the picker so far, by any thread
+  int searched;
+  int alpha;
+  int beta;
+  bool found_pv;
+  enum hash_flag_t flag;
+  struct move_t best_move;
+  struct move_t cutoff_move;
+  struct search_control_t *control;
+  atomic_bool cutoff;
+  // set once the picker ran out of moves
+  atomic_bool exhausted;
+  // threads still searching its moves, the master included, under
+  // _splits_lock
+  int workers;
+};
+
+/**
+ * Move at the root of search_iterative(), with the nodes its subtree took in
+ * the last iteration, a measure of how hard it is to refute.
+ */
+struct root_move_t {
+  struct move_t move;
+  uint64_t nodes;
+};
+
+/**
+ * Packed hash entry. `data` holds from bit 0 the score (16 bits, see
+ * pack_score), depth (8), flag (2), generation (8) and the best move's src
+ * and dst (8 each). `check` is the key xor-ed with `data`, so an entry torn
+ * by threads writing it at the same time fails the key check instead of
+ * pairing one position's key with another's result.
+ */
+struct hash_slot_t {
+  uint64_t check;
+  uint64_t data;
+};
+
+/**
+ * Slots the same key may be stored in. A store picks the slot already holding
+ * the key, else the one least worth keeping by depth and age.
+ */
+struct hash_bucket_t {
+  struct hash_slot_t slots[HASH_BUCKET_SLOTS];
+} __attribute__((aligned(64)));
+
+// A single bucket stands in until the first clear_hash_table(),
+// next_hash_generation() or resize allocates the table, so searches never
+// need to check for it.
+struct hash_bucket_t _no_hash_table;
+struct hash_bucket_t *_hash_table = &_no_hash_table;
+uint64_t _hash_mask = 0;
+uint8_t _hash_generation = 0;
+// how _hash_table was allocated, see alloc_hash_table()
+enum hash_pages_t _hash_pages = HASH_PAGES_NONE;
+void *_hash_alloc = NULL;
+
+struct search_thread_t _main_thread;
+// The calling thread's state, the main one unless it is a helper.
+_Thread_local struct search_thread_t *_thread = &_main_thread;
+struct search_thread_t *_helpers[MAX_SEARCH_THREADS];
+int _search_threads = 1;
+enum search_mode_t _search_mode = SEARCH_LAZY_SMP;
+int _running_helpers = 0;
+atomic_bool _helpers_stop;
+// SEARCH_SPLIT: one shared list of open split points, guarded with the split
+// points' `workers` by _splits_lock. Threads sleep on _splits_cond until a
+// split point opens, one they wait for is done or the search ends.
+pthread_mutex_t _splits_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t _splits_cond = PTHREAD_COND_INITIALIZER;
+struct split_point_t *_open_splits = NULL;
+// helpers asleep in split_worker, free to join any split point; masters
+// waiting in split() only join their own subtree and don't count
+atomic_int _free_helpers;
+struct search_tuning_t _tuning = {
+    .lmr_depth = 3,
+    .lmr_moves = 8,
+    .lmr_reduction = 2,
+    .sideways_depth = 1,
+    .backward_depth = 2,
+};
+
+// Start loading the bucket of the position just moved into, so the child's
+// probe finds it in cache.
+static inline void prefetch_hash(struct game_t *game) {
+  int sym;
+  uint64_t key = game_canonical_hash(game, &sym);
+  __builtin_prefetch(&_hash_table[key & _hash_mask]);
+}
+
+// Whether the thread's current subtree no longer matters: the search was
+// stopped, or is over for helpers, or a split point it works under was cut
+// off.
+static inline bool search_aborted(struct search_thread_t *thread,
+                                  struct search_control_t *control) {
+  if (control != NULL &&
+      atomic_load_explicit(&control->stop, memory_order_relaxed)) {
+    return true;
+  }
+  if (thread->helper &&
+      atomic_load_explicit(&_helpers_stop, memory_order_relaxed)) {
+    return true;
+  }
+  for (struct split_point_t *sp = thread->split; sp != NULL; sp = sp->parent) {
+    if (atomic_load_explicit(&sp->cutoff, memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void init_move_picker(struct move_picker_t *picker,
+                             struct game_t *game, struct move_t hash_move,
+                             int depth, struct move_t last_move) {
+  picker->stage = PICK_HASH;
+  picker->color = game->turn;
+  picker->tried[0] = hash_move;
+  picker->tried_len = 0;
+  picker->killers[0] = _thread->killer_moves[depth][0];
+  picker->killers[1] = _thread->killer_moves[depth][1];
+  picker->killers[2] = (struct move_t){.src = -1, .dst = -1};
+  if (last_move.src != -1) {
+    struct move_t counter =
+        _thread->counter_moves[last_move.src][last_move.dst];
+    if (counter.src != counter.dst) {
+      picker->killers[2] = counter;
+    }
+  }
+  picker->killer_index = 0;
+  picker->history = _thread->history;
+  picker->from = game->board.pieces[game->turn];
+  picker->reach.known = 0;
+  picker->moves.len = 0;
+  picker->index = 0;
+}
+
+static inline bool already_tried(struct move_picker_t *picker, int src,
+                                 int dst) {
+  for (int i = 0; i < picker->tried_len; i++) {
+    if (picker->tried[i].src == src && picker->tried[i].dst == dst) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Move the forward jumps, or all remaining destinations, out of the generated
+// bitboards and into the move list, scoring each move.
+static void emit_scored_moves(struct move_picker_t *picker, bool jumps) {
+  struct move_list_t *moves = &picker->moves;
+  int src, dst;
+  uint128_t from = picker->from;
+  int *side_scores = SIDE_SCORES[picker->color];
+  moves->len = 0;
+  picker->index = 0;
+  u128_for_each_1(from, src) {
+    uint128_t to = picker->reach.dests[src];
+    if (jumps) {
+      to &= ~ADJ_POSITIONS[src];
+    }
+    for (; to; to &= to - 1) {
+      dst = lsb_u128(to);
+      int distance = forward_distance(picker->color, src, dst);
+      if (jumps && distance <= 0) {
+        continue;
+      }
+      picker->reach.dests[src] &= ~MASK_AT(dst);
+      if (already_tried(picker, src, dst)) {
+        continue;
+      }
+      moves->moves[moves->len] = (struct move_t){.src = src, .dst = dst};
+      if (jumps) {
+        // gain in the evaluator's square score, then distance travelled
+        picker->scores[moves->len] =
+            (side_scores[dst] - side_scores[src]) * 32 + distance;
+      } else {
+        // distance travelled, then history among moves of the same distance
+        picker->scores[moves->len] =
+            distance * 2 * HISTORY_MAX + picker->history[src][dst];
+      }
+      moves->len++;
+    }
+  }
+}
+
+// Swap the best remaining move to the front and return it.
+static struct move_t *select_best(struct move_picker_t *picker) {
+  struct move_list_t *moves = &picker->moves;
+  int best = picker->index;
+  for (int i = picker->index + 1; i < moves->len; i++) {
+    if (picker->scores[i] > picker->scores[best]) {
+      best = i;
+    }
+  }
+  struct move_t move = moves->moves[best];
+  int score = picker->scores[best];
+  moves->moves[best] = moves->moves[picker->index];
+  picker->scores[best] = picker->scores[picker->index];
+  moves->moves[picker->index] = move;
+  picker->scores[picker->index] = score;
+  return &moves->moves[picker->index++];
+}
+
+static struct move_t *next_move(struct move_picker_t *picker,
+                                struct game_t *game) {
+  struct move_t *killer;
+  switch (picker->stage) {
+    case PICK_HASH:
+      picker->stage = PICK_KILLERS;
+      if (picker->tried[0].src != -1) {
+        picker->tried_len = 1;
+        return &picker->tried[0];
+      }
+      // fall through
+    case PICK_KILLERS:
+      while (picker->killer_index < 3) {
+        killer = &picker->killers[picker->killer_index++];
+        if (killer->src != -1 &&
+            !already_tried(picker, killer->src, killer->dst) &&
+            game_is_move_reachable(game, &picker->reach, killer)) {
+          picker->tried[picker->tried_len++] = *killer;
+          return killer;
+        }
+      }
+      picker->stage = PICK_GEN_JUMPS;
+      // fall through
+    case PICK_GEN_JUMPS:
+      // only the sources the killers didn't already flood
+      game_fill_reach(game, &picker->reach, picker->from);
+      emit_scored_moves(picker, true);
+      picker->stage = PICK_JUMPS;
+      // fall through
+    case PICK_JUMPS:
+      if (picker->index < picker->moves.len) {
+        return select_best(picker);
+      }
+      picker->stage = PICK_GEN_REST;
+      // fall through
+    case PICK_GEN_REST:
+      emit_scored_moves(picker, false);
+      picker->stage = PICK_REST;
+      // fall through
+    case PICK_REST:
+      if (picker->index < picker->moves.len) {
+        return select_best(picker);
+      }
+  }
+  return NULL;
+}
+
+// Score of `move`, already applied to `game`, for the side that made it,
+// searching the reply to `depth` in the window (alpha, beta). The child finds
+// `move` in the thread for its counter move.
+static inline int search_reply(struct search_thread_t *thread,
+                               struct game_t *game, struct move_t *move,
+                               int depth, int alpha, int beta,
+                               struct search_control_t *control) {
+  struct move_t best_move;
+  thread->last_move = *move;
+  return -alpha_beta_search(game, depth, -beta, -alpha, &best_move, control);
+}
+
+// Whether `move` is left out at a node of `depth` after `searched` moves:
+// moves more than a row back always are, sideways and one row back moves
+// near the horizon, see struct search_tuning_t.
+static inline bool prune_move(struct game_t *game, struct move_t *move,
+                              int depth, int searched) {
+  int distance = forward_distance(game->turn, move->src, move->dst);
+  if (distance < -1) {
+    return true;
+  }
+  if (searched == 0 || distance > 0) {
+    return false;
+  }
+  return depth <= (distance < 0 ? _tuning.backward_depth
+                                : _tuning.sideways_depth);
+}
+
+// Plies to take off the `searched`-th move of a node of `depth`, picked in
+// `stage`: moves of the last stage, which holds all but the forward jumps
+// and the hash, killer and counter moves, are reduced once enough moves were
+// searched before them.
+static inline int late_move_reduction(enum pick_stage_t stage, int depth,
+                                      int searched) {
+  if (stage != PICK_REST || depth < _tuning.lmr_depth ||
+      searched < _tuning.lmr_moves) {
+    return 0;
+  }
+  return _tuning.lmr_reduction < depth - 1 ? _tuning.lmr_reduction
+                                           : depth - 1;
+}
+
+// Score of `move`, already applied to `game`, at a node of `depth` with the
+// window (alpha, beta). Once the node has a PV move, other moves are first
+// searched with a null window, and again with the full one if they land
+// inside it. A move with a `reduction` is first searched that many plies
+// shallower with a null window, and only in full if it beats alpha there.
+static int search_move(struct search_thread_t *thread, struct game_t *game,
+                       struct move_t *move, int depth, int alpha, int beta,
+                       bool found_pv, int reduction,
+                       struct search_control_t *control) {
+  int score;
+  if (reduction > 0) {
+    score = search_reply(thread, game, move, depth - 1 - reduction, alpha,
+                         alpha + 1, control);
+    if (score <= alpha || search_aborted(thread, control)) {
+      return score;
+    }
+  }
+  if (!found_pv) {
+    return search_reply(thread, game, move, depth - 1, alpha, beta, control);
+  }
+  score = search_reply(thread, game, move, depth - 1, alpha, alpha + 1,
+                       control);
+  if (score > alpha && score < beta && !search_aborted(thread, control)) {
+    score = search_reply(thread, game, move, depth - 1, alpha, beta, control);
+  }
+  return score;
+}
+
+// Search moves of a split point on `game`, the thread's own copy of its
+// position, until they run out or someone cuts off.
+static void search_split_moves(struct search_thread_t *thread,
+                               struct split_point_t *sp,
+                               struct game_t *game) {
+  struct split_point_t *outer = thread->split;
+  struct move_t move;
+  thread->split = sp;
+  while (!search_aborted(thread, sp->control)) {
+    pthread_mutex_lock(&sp->lock);
+    struct move_t *next = next_move(sp->picker, &sp->game);
+    int alpha = sp->alpha, beta = sp->beta, searched = sp->searched;
+    bool found_pv = sp->found_pv, pruned = false;
+    enum pick_stage_t stage = sp->picker->stage;
+    if (next != NULL) {
+      move = *next;
+      pruned = prune_move(game, &move, sp->depth, searched);
+      sp->searched += !pruned;
+    }
+    pthread_mutex_unlock(&sp->lock);
+    if (next == NULL) {
+      atomic_store_explicit(&sp->exhausted, true, memory_order_relaxed);
+      break;
+    }
+    if (pruned) {
+      continue;
+    }
+
+    game_apply_move(game, &move);
+    prefetch_hash(game);
+    int score = search_move(thread, game, &move, sp->depth, alpha, beta,
+                            found_pv,
+                            late_move_reduction(stage, sp->depth, searched),
+                            sp->control);
+    game_undo_move(game, &move);
+    if (search_aborted(thread, sp->control)) {
+      break;
+    }
 
-struct hash_entry_t _hash_table[TABLE_SIZE];
-struct move_t _killer_moves[MAX_DEPTH][2];
+    pthread_mutex_lock(&sp->lock);
+    if (score >= sp->beta) {
+      sp->cutoff_move = move;
+      atomic_store_explicit(&sp->cutoff, true, memory_order_relaxed);
+    } else if (score > sp->alpha) {
+      sp->alpha = score;
+      sp->best_move = move;
+      sp->flag = HASH_EXACT;
+      sp->found_pv = true;
+    }
+    pthread_mutex_unlock(&sp->lock);
+  }
+  thread->split = outer;
+}
+
+// The open split point with the most depth left that still has moves to
+// give, among those below `under` if it isn't NULL. Call with _splits_lock
+// held.
+static struct split_point_t *find_open_split(struct split_point_t *under) {
+  struct split_point_t *best = NULL;
+  for (struct split_point_t *sp = _open_splits; sp != NULL; sp = sp->next) {
+    if (atomic_load_explicit(&sp->exhausted, memory_order_relaxed) ||
+        atomic_load_explicit(&sp->cutoff, memory_order_relaxed) ||
+        (best != NULL && sp->depth <= best->depth)) {
+      continue;
+    }
+    struct split_point_t *p = sp->parent;
+    while (under != NULL && p != NULL && p != under) {
+      p = p->parent;
+    }
+    if (under == NULL || p == under) {
+      best = sp;
+    }
+  }
+  return best;
+}
+
+// Search moves of `sp` alongside its master until they run out. Called and
+// returns with _splits_lock held, which is released meanwhile.
+static void join_split(struct search_thread_t *thread,
+                       struct split_point_t *sp) {
+  sp->workers++;
+  pthread_mutex_unlock(&_splits_lock);
+  // the thread's own game may be in use further up its stack
+  struct game_t game = sp->game;
+  search_split_moves(thread, sp, &game);
+  pthread_mutex_lock(&_splits_lock);
+  if (--sp->workers == 0) {
+    pthread_cond_broadcast(&_splits_cond);
+  }
+}
+
+// Open the remaining moves of the master's node to other threads and search
+// them together. Returns false, without searching anything, if no helper is
+// free to join. Once its own moves run out the master joins split points
+// below its node, opened by the threads still searching it, until they are
+// done.
+static bool split(struct search_thread_t *thread, struct game_t *game,
+                  struct split_point_t *sp) {
+  if (atomic_load_explicit(&_free_helpers, memory_order_relaxed) == 0) {
+    return false;
+  }
+  sp->workers = 1;
+  atomic_init(&sp->cutoff, false);
+  atomic_init(&sp->exhausted, false);
+  sp->parent = thread->split;
+  sp->game = *game;
+  // the jump graph is the master's, helpers regenerate moves instead
+  sp->game.graph = NULL;
+  pthread_mutex_init(&sp->lock, NULL);
+  pthread_mutex_lock(&_splits_lock);
+  sp->next = _open_splits;
+  _open_splits = sp;
+  pthread_cond_broadcast(&_splits_cond);
+  pthread_mutex_unlock(&_splits_lock);
+
+  search_split_moves(thread, sp, game);
+
+  pthread_mutex_lock(&_splits_lock);
+  struct split_point_t **link = &_open_splits;
+  while (*link != sp) {
+    link = &(*link)->next;
+  }
+  *link = sp->next;
+  sp->workers--;
+  while (sp->workers > 0) {
+    struct split_point_t *below = find_open_split(sp);
+    if (below != NULL) {
+      join_split(thread, below);
+    } else {
+      pthread_cond_wait(&_splits_cond, &_splits_lock);
+    }
+  }
+  pthread_mutex_unlock(&_splits_lock);
+  pthread_mutex_destroy(&sp->lock);
+  return true;
+}
+
+// Join open split points until the search is over, sleeping while there are
+// none.
+static void *split_worker(void *arg) {
+  struct search_thread_t *helper = arg;
+  _thread = helper;
+  pthread_mutex_lock(&_splits_lock);
+  while (!atomic_load_explicit(&_helpers_stop, memory_order_relaxed)) {
+    struct split_point_t *sp = find_open_split(NULL);
+    if (sp != NULL) {
+      join_split(helper, sp);
+    } else {
+      atomic_fetch_add_explicit(&_free_helpers, 1, memory_order_relaxed);
+      pthread_cond_wait(&_splits_cond, &_splits_lock);
+      atomic_fetch_sub_explicit(&_free_helpers, 1, memory_order_relaxed);
+    }
+  }
+  pthread_mutex_unlock(&_splits_lock);
+  return NULL;
+}
+
+// Remember a beta cutoff by `move`, the reply to `last_move`, in the killers,
+// history, counter moves and the hash table.
+static void store_cutoff(struct search_thread_t *thread, struct game_t *game,
+                         struct move_t *move, int depth, uint64_t key, int sym,
+                         int beta, struct move_t last_move) {
+  if (!move->hops) {
+    // killers are re-checked at every node, store them with their path
+    game_find_move_path(game, move);
+  }
+  if (!same_move(thread->killer_moves[depth][0], *move)) {
+    thread->killer_moves[depth][1] = thread->killer_moves[depth][0];
+    thread->killer_moves[depth][0] = *move;
+  }
+  int *history = &thread->history[move->src][move->dst];
+  int bonus = depth * depth;
+  *history += bonus - *history * bonus / HISTORY_MAX;
+  if (last_move.src != -1) {
+    thread->counter_moves[last_move.src][last_move.dst] = *move;
+  }
+  struct move_t best_move = *move;
+  symmetric_move(sym, &best_move);
+  record_hash(key, beta, depth, HASH_BETA, &best_move);
+}
+
+// Set the stop flag once the deadline has passed.
+static void poll_search(struct search_control_t *control) {
+  if (search_clock() > control->deadline) {
+    atomic_store_explicit(&control->stop, true, memory_order_relaxed);
+  }
+}
 
 int alpha_beta_search(struct game_t *game, int depth, int alpha, int beta,
-                      struct move_t *best_move, clock_t stop_time) {
+                      struct move_t *best_move,
+                      struct search_control_t *control) {
   int score;
-  struct list_head *pos, *_n;
   struct move_t *move;
-  struct move_t _best_move, _hash_move = {-1, -1}, _killer_move0, _killer_move1;
+  struct move_t _best_move, _hash_move = {.src = -1, .dst = -1};
+  struct search_thread_t *thread = _thread;
+  struct move_t last_move = thread->last_move;
+  struct move_picker_t *picker = &thread->move_pickers[depth];
   enum hash_flag_t flag = HASH_ALPHA;
-  bool found_pv = false, already_gen_moves = false;
-  struct hash_entry_t *entry = probe_hash(game->hash, depth, alpha, beta);
-  LIST_HEAD(moves);
+  bool found_pv = false;
+  // mirrored positions share one entry, stored under the smallest key with
+  // its move in that orientation
+  int sym;
+  uint64_t key = game_canonical_hash(game, &sym);
+  struct hash_entry_t entry;
+
+  thread->searched_nodes++;
+  if (control != NULL &&
+      (thread->searched_nodes & (control->poll_nodes - 1)) == 0) {
+    poll_search(control);
+  }
 
   // Look up hash table
-  if (entry != NULL) {
-    if (entry->depth >= depth) {
-      if (entry->flag == HASH_EXACT) {
-        *best_move = entry->best;
+  if (probe_hash(key, depth, alpha, beta, &entry)) {
+    if (entry.depth >= depth) {
+      if (entry.flag == HASH_EXACT) {
+        *best_move = entry.best;
+        symmetric_move(sym, best_move);
       }
-      return entry->value;
+      return entry.value;
     }
     // history best move
-    if (entry->flag == HASH_EXACT || entry->flag == HASH_BETA) {
-      _hash_move = entry->best;
+    if (entry.flag == HASH_EXACT || entry.flag == HASH_BETA) {
+      _hash_move = entry.best;
+      symmetric_move(sym, &_hash_move);
     }
   }
 
@@ -61,74 +663,36 @@ int alpha_beta_search(struct game_t *game, int depth, int alpha, int beta,
   // Null-Move Forward Pruning
   if (depth - 1 - NULL_MOVE_R >= 0) {
     game_apply_null_move(game);
-    score = -alpha_beta_search(game, depth - 1 - NULL_MOVE_R, -beta, -beta + 1,
-                               &_best_move, stop_time);
+    prefetch_hash(game);
+    score = search_reply(thread, game, &(struct move_t){.src = -1, .dst = -1},
+                         depth - 1 - NULL_MOVE_R, beta - 1, beta, control);
     game_undo_null_move(game);
     if (score >= beta) {
       return beta;
     }
   }
 
-  pos = moves.next;
-  if (_killer_moves[depth][0].src != -1 &&
-      game_is_move_valid(game, &_killer_moves[depth][0])) {
-    // try killer move 0
-    _killer_move0 = _killer_moves[depth][0];
-    _killer_move0.list.next = pos;
-    pos = &_killer_move0.list;
-  }
-  if (_killer_moves[depth][1].src != -1 &&
-      game_is_move_valid(game, &_killer_moves[depth][1])) {
-    // try killer move 1
-    _killer_move1 = _killer_moves[depth][1];
-    _killer_move1.list.next = pos;
-    pos = &_killer_move1.list;
-  }
-  if (_hash_move.src != -1) {
-    // try hash move first
-    _hash_move.list.next = pos;
-    pos = &_hash_move.list;
-  }
-  while (pos != &moves || !already_gen_moves) {
-    if (pos == &moves) {
-      // the history best move and killer moves can't cut off the search
-      // generate normal moves
-      gen_moves(&(game->board),
-                game->turn == PIECE_RED ? game->board.red : game->board.green,
-                &moves);
-      sort_moves(&moves, game->turn);
-      already_gen_moves = true;
-      pos = moves.next;
-      continue;
-    }
-
-    move = list_entry(pos, struct move_t, list);
-
-    if (forward_distance(game->turn, move->src, move->dst) < -1) {
-      // skip backward moves
-      pos = pos->next;
+  init_move_picker(picker, game, _hash_move, depth, last_move);
+  int searched = 0;
+  while ((move = next_move(picker, game)) != NULL) {
+    if (prune_move(game, move, depth, searched)) {
       continue;
     }
 
     game_apply_move(game, move);
-    if (found_pv) {
-      score = -alpha_beta_search(game, depth - 1, -alpha - 1, -alpha,
-                                 &_best_move, stop_time);
-      if (score > alpha && score < beta) {
-        score = -alpha_beta_search(game, depth - 1, -beta, -alpha, &_best_move,
-                                   stop_time);
-      }
-    } else {
-      score = -alpha_beta_search(game, depth - 1, -beta, -alpha, &_best_move,
-                                 stop_time);
-    }
+    prefetch_hash(game);
+    score = search_move(thread, game, move, depth, alpha, beta, found_pv,
+                        late_move_reduction(picker->stage, depth, searched),
+                        control);
     game_undo_move(game, move);
+    searched++;
+    if (search_aborted(thread, control)) {
+      // the score is from an unfinished subtree, keep it out of the table
+      return 0;
+    }
 
     if (score >= beta) {
-      _killer_moves[depth][1] = _killer_moves[depth][0];
-      _killer_moves[depth][0] = *move;
-      record_hash(game->hash, beta, depth, HASH_BETA, move);
-      free_moves(&moves);
+      store_cutoff(thread, game, move, depth, key, sym, beta, last_move);
       return beta;
     }
     if (score > alpha) {
@@ -137,54 +701,515 @@ int alpha_beta_search(struct game_t *game, int depth, int alpha, int beta,
       found_pv = true;
       alpha = score;
     }
-    if (clock() > stop_time) {
-      // return SCORE_NAN;
-      break;
+
+    // young brothers wait: once the first move is searched, the others may
+    // be shared with idle threads
+    if (_search_mode == SEARCH_SPLIT && depth >= SPLIT_MIN_DEPTH &&
+        _running_helpers > 0) {
+      struct split_point_t sp;
+      sp.picker = picker;
+      sp.depth = depth;
+      sp.searched = searched;
+      sp.alpha = alpha;
+      sp.beta = beta;
+      sp.found_pv = found_pv;
+      sp.flag = flag;
+      sp.best_move = *best_move;
+      sp.control = control;
+      if (split(thread, game, &sp)) {
+        if (search_aborted(thread, control)) {
+          return 0;
+        }
+        if (atomic_load(&sp.cutoff)) {
+          store_cutoff(thread, game, &sp.cutoff_move, depth, key, sym, beta,
+                       last_move);
+          return beta;
+        }
+        alpha = sp.alpha;
+        flag = sp.flag;
+        *best_move = sp.best_move;
+        break;
+      }
     }
-    pos = pos->next;
   }
 
-  record_hash(game->hash, alpha, depth, flag, best_move);
-  free_moves(&moves);
+  _best_move = *best_move;
+  symmetric_move(sym, &_best_move);
+  record_hash(key, alpha, depth, flag, &_best_move);
   return alpha;
 }
 
+// Scores in 16 bits. Evaluations are far below the codes at the ends, which
+// are kept for wins and for the infinite bounds.
+#define SCORE_CODE_WIN 32766
+#define SCORE_CODE_MAX 32767
+
+// Code of a score >= 0, rounded up or down if it falls between codes.
+static inline int score_code(int score, bool up) {
+  if (score < SCORE_CODE_WIN) {
+    return score;
+  } else if (score < SCORE_WIN) {
+    return up ? SCORE_CODE_WIN : SCORE_CODE_WIN - 1;
+  } else if (score == SCORE_WIN || (score < SCORE_MAX && !up)) {
+    return SCORE_CODE_WIN;
+  }
+  return SCORE_CODE_MAX;
+}
+
+// Scores between codes round so that bounds stay bounds: upper ones
+// (HASH_ALPHA) up, lower ones (HASH_BETA) down, exact ones towards zero.
+static inline uint16_t pack_score(int score, enum hash_flag_t flag) {
+  int code = score >= 0 ? score_code(score, flag == HASH_ALPHA)
+                        : -score_code(-score, flag == HASH_BETA);
+  return (uint16_t)code;
+}
+
+static inline int unpack_score(uint16_t bits) {
+  int code = (int16_t)bits;
+  int sign = code < 0 ? -1 : 1;
+  if (code * sign == SCORE_CODE_MAX) {
+    return sign * SCORE_MAX;
+  }
+  return code * sign == SCORE_CODE_WIN ? sign * SCORE_WIN : code;
+}
+
+static inline uint64_t pack_entry(int value, int depth, enum hash_flag_t flag,
+                                  struct move_t *best) {
+  return pack_score(value, flag) | (uint64_t)(uint8_t)depth << 16 |
+         (uint64_t)flag << 24 | (uint64_t)_hash_generation << 26 |
+         (uint64_t)(uint8_t)best->src << 34 |
+         (uint64_t)(uint8_t)best->dst << 42;
+}
+
+#define entry_depth(data) ((int)((data) >> 16 & 0xff))
+#define entry_generation(data) ((uint8_t)((data) >> 26))
+
 void record_hash(uint64_t hash, int value, int depth, enum hash_flag_t flag,
                  struct move_t *best) {
-  struct hash_entry_t *entry = &_hash_table[hash & TABLE_MASK];
-  if (entry->hash == hash && entry->depth > depth) {
-    return;
+  struct hash_bucket_t *bucket = &_hash_table[hash & _hash_mask];
+  struct hash_slot_t *slot = NULL;
+  int worst = INT_MAX;
+  for (int i = 0; i < HASH_BUCKET_SLOTS; i++) {
+    struct hash_slot_t entry = bucket->slots[i];
+    if ((entry.check ^ entry.data) == hash) {
+      // a deeper result of this search is worth more than the new one
+      if (entry_generation(entry.data) == _hash_generation &&
+          entry_depth(entry.data) > depth) {
+        return;
+      }
+      slot = &bucket->slots[i];
+      break;
+    }
+    // entries of earlier searches count 8 plies shallower per search
+    uint8_t age = _hash_generation - entry_generation(entry.data);
+    int worth = entry_depth(entry.data) - 8 * age;
+    if (worth < worst) {
+      worst = worth;
+      slot = &bucket->slots[i];
+    }
+  }
+  struct hash_slot_t entry;
+  entry.data = pack_entry(value, depth, flag, best);
+  entry.check = hash ^ entry.data;
+  *slot = entry;
+}
+
+bool probe_hash(uint64_t hash, int depth, int alpha, int beta,
+                struct hash_entry_t *entry) {
+  // the caller checks the entry's depth, it still wants the move of a
+  // shallower one
+  (void)depth;
+  struct hash_bucket_t *bucket = &_hash_table[hash & _hash_mask];
+  uint64_t data;
+  int i = 0;
+  for (;; i++) {
+    if (i == HASH_BUCKET_SLOTS) {
+      return false;
+    }
+    struct hash_slot_t slot = bucket->slots[i];
+    if ((slot.check ^ slot.data) == hash) {
+      data = slot.data;
+      break;
+    }
   }
   entry->hash = hash;
-  entry->value = value;
-  entry->depth = depth;
-  entry->flag = flag;
-  entry->best = *best;
+  entry->value = unpack_score((uint16_t)data);
+  entry->depth = entry_depth(data);
+  entry->flag = data >> 24 & 3;
+  entry->generation = entry_generation(data);
+  entry->best = (struct move_t){.src = (int8_t)(data >> 34),
+                                .dst = (int8_t)(data >> 42)};
+  if (entry->flag == HASH_EXACT) {
+    return true;
+  } else if (entry->flag == HASH_ALPHA && entry->value <= alpha) {
+    return true;
+  } else if (entry->flag == HASH_BETA && entry->value >= beta) {
+    return true;
+  }
+  return false;
 }
 
-struct hash_entry_t *probe_hash(uint64_t hash, int depth, int alpha, int beta) {
-  struct hash_entry_t *entry = &_hash_table[hash & TABLE_MASK];
-  if (entry->hash == hash) {
-    if (entry->flag == HASH_EXACT) {
-      return entry;
-    } else if (entry->flag == HASH_ALPHA && entry->value <= alpha) {
-      return entry;
-    } else if (entry->flag == HASH_BETA && entry->value >= beta) {
-      return entry;
+// Allocate zeroed buckets. Where the OS allows it they are mapped straight
+// from explicit huge pages, else from normal pages marked for transparent
+// huge pages; either way nothing is touched until a search stores into it.
+static struct hash_bucket_t *alloc_hash_table(size_t bytes,
+                                              enum hash_pages_t *pages) {
+#ifdef __linux__
+  void *table = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (bytes >= HUGE_PAGE_SIZE) {
+    table = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    *pages = HASH_PAGES_HUGETLB;
+  }
+#endif
+  if (table == MAP_FAILED) {
+    table = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    *pages = HASH_PAGES_MAPPED;
+#ifdef MADV_HUGEPAGE
+    if (table != MAP_FAILED && bytes >= HUGE_PAGE_SIZE &&
+        madvise(table, bytes, MADV_HUGEPAGE) == 0) {
+      *pages = HASH_PAGES_THP;
     }
+#endif
   }
-  return NULL;
+  if (table != MAP_FAILED) {
+    _hash_alloc = table;
+    return table;
+  }
+#endif
+  // large calloc()s are zero pages from the OS too, aligned here by hand
+  _hash_alloc = calloc(1, bytes + sizeof(struct hash_bucket_t));
+  *pages = HASH_PAGES_HEAP;
+  if (_hash_alloc == NULL) {
+    return NULL;
+  }
+  uintptr_t aligned = ((uintptr_t)_hash_alloc + sizeof(struct hash_bucket_t)) &
+                      ~(uintptr_t)(sizeof(struct hash_bucket_t) - 1);
+  return (struct hash_bucket_t *)aligned;
 }
 
+static void free_hash_table() {
+  if (_hash_table == &_no_hash_table) {
+    return;
+  }
+#ifdef __linux__
+  if (_hash_pages != HASH_PAGES_HEAP) {
+    munmap(_hash_alloc, (_hash_mask + 1) * sizeof(struct hash_bucket_t));
+  } else {
+    free(_hash_alloc);
+  }
+#else
+  free(_hash_alloc);
+#endif
+  _hash_table = &_no_hash_table;
+  _hash_mask = 0;
+  _hash_pages = HASH_PAGES_NONE;
+}
+
+bool set_hash_entries(uint64_t entries) {
+  uint64_t buckets = 1;
+  while (buckets * 2 * HASH_BUCKET_SLOTS <= entries) {
+    buckets *= 2;
+  }
+  if (_hash_table != &_no_hash_table && buckets == _hash_mask + 1) {
+    clear_hash_table();
+    return true;
+  }
+  free_hash_table();
+  enum hash_pages_t pages;
+  struct hash_bucket_t *table =
+      alloc_hash_table(buckets * sizeof(struct hash_bucket_t), &pages);
+  if (table == NULL) {
+    return false;
+  }
+  _hash_table = table;
+  _hash_mask = buckets - 1;
+  _hash_pages = pages;
+  _hash_generation = 0;
+  return true;
+}
+
+bool set_hash_mb(int mb) {
+  return set_hash_entries(((uint64_t)mb << 20) / sizeof(struct hash_slot_t));
+}
+
+uint64_t hash_entries() { return (_hash_mask + 1) * HASH_BUCKET_SLOTS; }
+
+enum hash_pages_t hash_pages() { return _hash_pages; }
+
 void clear_hash_table() {
-  for (int i = 0; i < TABLE_SIZE; i++) {
-    _hash_table[i].hash = 0;
+  size_t bytes = (_hash_mask + 1) * sizeof(struct hash_bucket_t);
+  if (_hash_table == &_no_hash_table) {
+    set_hash_mb(DEFAULT_HASH_MB);
+    return;
+  }
+#if defined(__linux__) && defined(MADV_DONTNEED)
+  // hand the pages back, they come back zeroed when next stored into
+  if (_hash_pages != HASH_PAGES_HEAP &&
+      madvise(_hash_table, bytes, MADV_DONTNEED) == 0) {
+    _hash_generation = 0;
+    return;
   }
+#endif
+  memset(_hash_table, 0, bytes);
+  _hash_generation = 0;
 }
 
+void next_hash_generation() {
+  if (_hash_table == &_no_hash_table) {
+    set_hash_mb(DEFAULT_HASH_MB);
+  }
+  _hash_generation++;
+}
+
+double search_clock() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void init_search_control(struct search_control_t *control, double seconds) {
+  control->deadline = seconds > 0 ? search_clock() + seconds : HUGE_VAL;
+  control->poll_nodes = SEARCH_POLL_NODES;
+  atomic_init(&control->stop, false);
+}
+
+void stop_search(struct search_control_t *control) {
+  atomic_store(&control->stop, true);
+}
+
+bool search_stopped(struct search_control_t *control) {
+  return control != NULL && atomic_load(&control->stop);
+}
+
+uint64_t searched_nodes() { return _thread->searched_nodes; }
+
+void clear_searched_nodes() { _thread->searched_nodes = 0; }
+
 void clear_killer_moves() {
   for (int i = 0; i < MAX_DEPTH; i++) {
-    _killer_moves[i][0] = (struct move_t){-1, -1};
-    _killer_moves[i][1] = (struct move_t){-1, -1};
+    _thread->killer_moves[i][0] = (struct move_t){.src = -1, .dst = -1};
+    _thread->killer_moves[i][1] = (struct move_t){.src = -1, .dst = -1};
+  }
+}
+
+static void reset_history(struct search_thread_t *thread) {
+  memset(thread->history, 0, sizeof(thread->history));
+  memset(thread->counter_moves, 0, sizeof(thread->counter_moves));
+  thread->last_move = (struct move_t){.src = -1, .dst = -1};
+}
+
+void clear_history() { reset_history(_thread); }
+
+void set_search_tuning(struct search_tuning_t *tuning) { _tuning = *tuning; }
+
+struct search_tuning_t search_tuning() { return _tuning; }
+
+void set_search_threads(int threads) {
+  _search_threads = threads < 1                    ? 1
+                    : threads > MAX_SEARCH_THREADS ? MAX_SEARCH_THREADS
+                                                   : threads;
+}
+
+int search_threads() { return _search_threads; }
+
+void set_search_mode(enum search_mode_t mode) { _search_mode = mode; }
+
+// Iterative deepening on the helper's copy of the game until told to stop.
+// Depths are skipped in a pattern that depends on the helper, so the threads
+// spread over the current and the next few depths instead of all searching
+// the same tree.
+static void *helper_search(void *arg) {
+  static const int skip_size[20] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                    3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+  static const int skip_phase[20] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3,
+                                     4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+  struct search_thread_t *helper = arg;
+  int i = helper->index % 20;
+  _thread = helper;
+  for (int d = 1; d < MAX_DEPTH - 1; d++) {
+    if ((d + skip_phase[i]) / skip_size[i] % 2 != 0) {
+      continue;
+    }
+    if (atomic_load_explicit(&_helpers_stop, memory_order_relaxed)) {
+      break;
+    }
+    struct move_t best_move;
+    helper->last_move = (struct move_t){.src = -1, .dst = -1};
+    alpha_beta_search(&helper->game, d, SCORE_MIN, SCORE_MAX, &best_move,
+                      NULL);
   }
-}
\ No newline at end of file
+  return NULL;
+}
+
+void start_search_helpers(struct game_t *game) {
+  atomic_store(&_helpers_stop, false);
+  _running_helpers = _search_threads - 1;
+  for (int i = 0; i < _running_helpers; i++) {
+    if (_helpers[i] == NULL) {
+      _helpers[i] = calloc(1, sizeof(struct search_thread_t));
+      _helpers[i]->helper = true;
+      _helpers[i]->index = i + 1;
+    }
+    _helpers[i]->game = *game;
+    // jump graphs are per game, the helpers regenerate moves instead
+    _helpers[i]->game.graph = NULL;
+    _helpers[i]->searched_nodes = 0;
+    _helpers[i]->split = NULL;
+    for (int d = 0; d < MAX_DEPTH; d++) {
+      _helpers[i]->killer_moves[d][0] = (struct move_t){.src = -1, .dst = -1};
+      _helpers[i]->killer_moves[d][1] = (struct move_t){.src = -1, .dst = -1};
+    }
+    reset_history(_helpers[i]);
+    pthread_create(&_helpers[i]->thread, NULL,
+                   _search_mode == SEARCH_SPLIT ? split_worker : helper_search,
+                   _helpers[i]);
+  }
+}
+
+void stop_search_helpers() {
+  atomic_store(&_helpers_stop, true);
+  pthread_mutex_lock(&_splits_lock);
+  pthread_cond_broadcast(&_splits_cond);
+  pthread_mutex_unlock(&_splits_lock);
+  for (int i = 0; i < _running_helpers; i++) {
+    pthread_join(_helpers[i]->thread, NULL);
+    _thread->searched_nodes += _helpers[i]->searched_nodes;
+  }
+  _running_helpers = 0;
+}
+
+// One iteration over the root moves in order, as alpha_beta_search would do
+// it, counting every subtree's nodes and moving a new best move to the front.
+// Clears *complete if the search was stopped before all moves were searched.
+static int search_root(struct game_t *game, struct root_move_t *moves, int len,
+                       int depth, int alpha, int beta,
+                       struct search_control_t *control, bool *complete) {
+  struct search_thread_t *thread = _thread;
+  int score;
+  thread->searched_nodes++;
+  *complete = false;
+  for (int i = 0; i < len; i++) {
+    struct root_move_t root = moves[i];
+    uint64_t nodes = thread->searched_nodes;
+    game_apply_move(game, &root.move);
+    prefetch_hash(game);
+    score = search_move(thread, game, &root.move, depth, alpha, beta, i > 0,
+                        0, control);
+    game_undo_move(game, &root.move);
+    root.nodes = moves[i].nodes = thread->searched_nodes - nodes;
+    if (search_stopped(control)) {
+      return alpha;
+    }
+    if (score > alpha) {
+      // the others keep their order behind it
+      memmove(&moves[1], &moves[0], i * sizeof(*moves));
+      moves[0] = root;
+      alpha = score;
+    }
+    if (score >= beta) {
+      break;
+    }
+  }
+  *complete = true;
+  return alpha < beta ? alpha : beta;
+}
+
+// Biggest subtrees first, keeping the order of equal ones.
+static void sort_root_moves(struct root_move_t *moves, int len) {
+  for (int i = 1; i < len; i++) {
+    struct root_move_t move = moves[i];
+    int j = i;
+    for (; j > 0 && moves[j - 1].nodes < move.nodes; j--) {
+      moves[j] = moves[j - 1];
+    }
+    moves[j] = move;
+  }
+}
+
+int search_iterative(struct game_t *game, int max_depth,
+                     struct search_control_t *control, search_report_t report,
+                     struct search_result_t *result) {
+  struct root_move_t moves[MAX_MOVES];
+  struct move_list_t list;
+  uint64_t nodes = _thread->searched_nodes;
+  double start = search_clock();
+  int len = 0;
+  result->best_move = (struct move_t){.src = -1, .dst = -1};
+  result->score = 0;
+  result->depth = 0;
+
+  list.len = 0;
+  game_gen_moves(game, game->board.pieces[game->turn], &list);
+  sort_moves(&list, game->turn);
+  for (int i = 0; i < list.len; i++) {
+    struct move_t *move = &list.moves[i];
+    // skip backward moves, as alpha_beta_search does, unless there is nothing
+    // else
+    if (forward_distance(game->turn, move->src, move->dst) >= -1) {
+      moves[len++] = (struct root_move_t){*move, 0};
+    }
+  }
+  if (len == 0) {
+    for (; len < list.len; len++) {
+      moves[len] = (struct root_move_t){list.moves[len], 0};
+    }
+  }
+  if (len > 0) {
+    // in case not even the first iteration completes
+    result->best_move = moves[0].move;
+  }
+  if (max_depth > MAX_DEPTH - 1) {
+    max_depth = MAX_DEPTH - 1;
+  }
+
+  start_search_helpers(game);
+  for (int depth = 1; depth <= max_depth && len > 0; depth++) {
+    int alpha = SCORE_MIN, beta = SCORE_MAX, window = ASPIRATION_WINDOW, score;
+    bool complete;
+    if (search_stopped(control)) {
+      break;
+    }
+    if (depth >= ASPIRATION_MIN_DEPTH && result->score > -SCORE_WIN &&
+        result->score < SCORE_WIN) {
+      alpha = result->score - window;
+      beta = result->score + window;
+    }
+    clear_killer_moves();
+    for (;;) {
+      score = search_root(game, moves, len, depth, alpha, beta, control,
+                          &complete);
+      if (!complete || (score > alpha && score < beta)) {
+        break;
+      }
+      window *= 4;
+      if (score <= alpha) {
+        alpha = window > ASPIRATION_MAX_WINDOW ? SCORE_MIN : score - window;
+      } else {
+        beta = window > ASPIRATION_MAX_WINDOW ? SCORE_MAX : score + window;
+      }
+    }
+    if (!complete) {
+      break;
+    }
+    sort_root_moves(moves + 1, len - 1);
+    result->best_move = moves[0].move;
+    result->score = score;
+    result->depth = depth;
+    result->searched_nodes = _thread->searched_nodes - nodes;
+    result->seconds = search_clock() - start;
+    if (report != NULL) {
+      report(result);
+    }
+    if (score >= SCORE_WIN || score <= -SCORE_WIN) {
+      // the game is decided, deeper searches won't change it
+      break;
+    }
+  }
+  stop_search_helpers();
+  result->searched_nodes = _thread->searched_nodes - nodes;
+  result->seconds = search_clock() - start;
+  return result->score;
+}
@@ -1,14 +1,70 @@
 #ifndef _SEARCH_H
 #define _SEARCH_H
 
-#include <time.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 
 #include "checkers.h"
 
+#define MAX_SEARCH_THREADS 64
+// Nodes a thread searches between looks at the clock, by default.
+#define SEARCH_POLL_NODES 1024
+
+/**
+ * Limits of one search, shared by all its threads. `deadline` is in seconds
+ * of search_clock(), `poll_nodes` how many nodes a thread searches between
+ * looks at it, a power of two. `stop` is set once the deadline passes, and
+ * may be set by any other thread to end the search early, see stop_search().
+ * A NULL control searches without limits.
+ */
+struct search_control_t {
+  double deadline;
+  uint64_t poll_nodes;
+  atomic_bool stop;
+};
+
+/**
+ * Outcome of search_iterative(): the best move and score of the deepest
+ * completed iteration, with the nodes and seconds spent so far.
+ */
 struct search_result_t {
   struct move_t best_move;
-  int searched_nodes;
+  int score;
+  int depth;
+  uint64_t searched_nodes;
+  double seconds;
+};
+
+// Called by search_iterative() after every completed iteration.
+typedef void (*search_report_t)(struct search_result_t *result);
+
+enum search_mode_t {
+  // helpers search the same position on their own, sharing the hash table
+  SEARCH_LAZY_SMP,
+  // nodes whose first move is searched open their remaining moves to idle
+  // threads (Young Brothers Wait). Open nodes go on one shared list, where
+  // free helpers take the one with the most depth left, rather than on
+  // per-thread queues to steal from.
+  SEARCH_SPLIT,
+};
+
+/**
+ * Selectivity of alpha_beta_search. At nodes at least `lmr_depth` deep,
+ * moves after the first `lmr_moves` are searched `lmr_reduction` plies
+ * shallower with a null window, and again at full depth if they beat alpha.
+ * Forward jumps and the hash, killer and counter moves are never reduced.
+ * Once a node has searched a move, its other sideways moves are skipped
+ * within `sideways_depth` plies of the horizon, and moves one row back
+ * within `backward_depth`. Moves further back are always skipped. A depth
+ * of 0 turns pruning off, an `lmr_depth` above the search depth the
+ * reductions.
+ */
+struct search_tuning_t {
+  int lmr_depth;
+  int lmr_moves;
+  int lmr_reduction;
+  int sideways_depth;
+  int backward_depth;
 };
 
 enum hash_flag_t {
@@ -17,25 +73,117 @@ enum hash_flag_t {
   HASH_BETA,
 };
 
+/**
+ * Transposition table entry as probe_hash hands it out. The table packs it in
+ * 16 bytes, keeping only the source and destination of `best`. `generation`
+ * is the search that last stored it, see next_hash_generation().
+ */
 struct hash_entry_t {
   uint64_t hash;
-  int value;
-  int depth;
-  enum hash_flag_t flag;
   struct move_t best;
+  int value;
+  int16_t depth;
+  uint8_t flag;
+  uint8_t generation;
+};
+
+// Entries per bucket, a bucket being one 64-byte cache line.
+#define HASH_BUCKET_SLOTS 4
+
+// Memory behind the hash table, best first.
+enum hash_pages_t {
+  HASH_PAGES_HUGETLB,  // explicit huge pages
+  HASH_PAGES_THP,      // normal mapping, transparent huge pages requested
+  HASH_PAGES_MAPPED,   // normal mapping
+  HASH_PAGES_HEAP,     // calloc()
+  HASH_PAGES_NONE,     // not allocated yet
 };
 
+// Seconds on a monotonic wall clock, the same for all threads.
+double search_clock();
+
+// Allow the search `seconds` from now, or no time limit if it is 0 or less.
+void init_search_control(struct search_control_t *control, double seconds);
+
+void stop_search(struct search_control_t *control);
+
+// Whether a search under `control` was stopped. Its results are then
+// incomplete: scores and moves of unfinished nodes are meaningless, and
+// nothing about them was stored in the hash table.
+bool search_stopped(struct search_control_t *control);
 
 int alpha_beta_search(struct game_t *game, int depth, int alpha, int beta,
-                      struct move_t *best_move, clock_t stop_time);
+                      struct move_t *best_move,
+                      struct search_control_t *control);
+
+// Search `game` by iterative deepening to `max_depth` or until stopped,
+// running the helper threads of search_threads() and set_search_mode(). From
+// the third iteration on the root is searched in an aspiration window around
+// the previous score, widened on the failing side until the score falls
+// inside, and root moves are tried best first, then by the nodes their
+// subtrees took in the previous iteration. An iteration cut short by
+// `control` is dropped. `report` may be NULL. Returns result->score.
+int search_iterative(struct game_t *game, int max_depth,
+                     struct search_control_t *control, search_report_t report,
+                     struct search_result_t *result);
 
 void record_hash(uint64_t hash, int value, int depth, enum hash_flag_t flag,
                  struct move_t *best);
 
-struct hash_entry_t *probe_hash(uint64_t hash, int depth, int alpha, int beta);
+// Copy the entry of `hash` into `entry` if it holds a usable bound. Entries are
+// checked against torn writes, so probing is safe while other threads store.
+bool probe_hash(uint64_t hash, int depth, int alpha, int beta,
+                struct hash_entry_t *entry);
+
+// Size the hash table to the largest power of two entries (at most `entries`,
+// or fitting in `mb` megabytes), emptying it. Returns false if it can't be
+// allocated, leaving no table until the next clear_hash_table(). Without a
+// call the first clear_hash_table() or next_hash_generation() allocates 128 MB.
+// The memory is only touched as the search stores into it.
+bool set_hash_entries(uint64_t entries);
+
+bool set_hash_mb(int mb);
+
+uint64_t hash_entries();
+
+enum hash_pages_t hash_pages();
 
 void clear_hash_table();
 
+// Start a new search without clearing the table: entries of earlier searches
+// stay usable but are the first to be replaced.
+void next_hash_generation();
+
+// Killers, history and node counts belong to the calling thread.
 void clear_killer_moves();
 
+// Forget the history scores and counter moves that order quiet moves.
+void clear_history();
+
+uint64_t searched_nodes();
+
+void clear_searched_nodes();
+
+// Threads searching a position, including the caller, 1 by default.
+void set_search_threads(int threads);
+
+int search_threads();
+
+void set_search_tuning(struct search_tuning_t *tuning);
+
+struct search_tuning_t search_tuning();
+
+// How helper threads take part in a search, SEARCH_LAZY_SMP by default.
+void set_search_mode(enum search_mode_t mode);
+
+// Run search_threads() - 1 helper threads until stop_search_helpers(), which
+// adds their nodes to the caller's count. In SEARCH_LAZY_SMP mode they search
+// a copy of `game` by iterative deepening at staggered depths, filling the
+// shared hash table for the caller's own alpha_beta_search calls. In
+// SEARCH_SPLIT mode they sleep until the caller's alpha_beta_search opens
+// moves to them, searching them under the caller's search control.
+void start_search_helpers(struct game_t *game);
+
+void stop_search_helpers();
+
 #endif  // _SEARCH_H
\ No newline at end of file
@@ -1,16 +1,12 @@
+import sys
+
+
 def hex128(n):
     lower = n & 0xFFFFFFFFFFFFFFFF
     upper = n >> 64
     return f"((__uint128_t)0x{upper:016x} << 64) | 0x{lower:016x}"
 
 
-def uint128array(name, values):
-    print(f"const __uint128_t {name}[81] = {{")
-    for i in range(81):
-        print(f"    {hex128(values[i])},")
-    print("};")
-
-
 ADJ_POSITIONS = [
     [9, 1],
     [10, 9, 0, 2],
@@ -263,76 +259,62 @@ JUMP_POSITIONS_MASK = [
     [71, 79],
 ]
 
-weights = {
-    1: 1,
-    2: 2,
-    9: 4,
-    11: 8,
-    18: 16,
-    19: 32,
-}
+# Neighbour offsets in the bit order of the 6-bit jump index (see hash_adj in
+# src/checkers.c).
+OFFSETS = [-9, -8, -1, 1, 8, 9]
 
 
-def gen_mask_mapping():
-    b = [1, 2, 9, 11, 18, 19]
-    a = []
-    for i in range(64):
-        mask_num = i
-        mask = 0
-        for j in range(6):
-            if mask_num & 1:
-                mask |= 1 << b[j]
-            mask_num >>= 1
-        a.append(mask)
-    m = {}
-    for i in range(64):
-        m[a[i]] = i
-    return m
+def jump_directions(i):
+    """Bit set of the directions in which square i can jump without leaving
+    the board."""
+    directions = 0
+    for over, to in zip(JUMP_POSITIONS_MASK[i], JUMP_POSITIONS[i]):
+        offset = over - i
+        assert to == i + 2 * offset
+        directions |= 1 << OFFSETS.index(offset)
+    return directions
+
 
+def jump_landings(index):
+    """Landing squares of the jumps in `index`, relative to square p - 20."""
+    landings = 0
+    for j, offset in enumerate(OFFSETS):
+        if index & (1 << j):
+            landings |= 1 << (20 + 2 * offset)
+    return landings
 
-MASK_MAPPING = gen_mask_mapping()
 
-for i in range(81):
-    table = {}
-    for j in range(2 ** len(JUMP_POSITIONS[i])):
+def main(out):
+    out.write("// Generated by tests/constants.py, do not edit.\n")
+    out.write("#ifndef _CONSTANTS_H\n#define _CONSTANTS_H\n\n")
+    out.write("#include <stdint.h>\n\n")
+
+    out.write("const __uint128_t ADJ_POSITIONS[81] = {\n")
+    for i in range(81):
         mask = 0
-        to = 0
-        for k in range(len(JUMP_POSITIONS[i])):
-            if j & (1 << k):
-                mask |= 1 << JUMP_POSITIONS_MASK[i][k]
-                to |= 1 << JUMP_POSITIONS[i][k]
-        table[mask] = to
-    if len(JUMP_POSITIONS[i]) != len(ADJ_POSITIONS[i]):
-        diff = list(set(ADJ_POSITIONS[i]) - set(JUMP_POSITIONS_MASK[i]))
-        for j in range(len(diff)):
-            for key in list(table.keys()):
-                add_key = key | (1 << diff[j])
-                table[add_key] = table[key]
-    table_2 = {}
-    for key in table:
-        if i > 10:
-            table_2[MASK_MAPPING[key >> (i - 10)]] = table[key]
-        else:
-            table_2[MASK_MAPPING[key << (10 - i)]] = table[key]
+        for pos in ADJ_POSITIONS[i]:
+            mask |= 1 << pos
+        out.write(f"    {hex128(mask)},\n")
+    out.write("};\n\n")
 
-    JUMP_POSITIONS[i] = table_2
+    out.write("const uint8_t JUMP_DIRECTIONS[81] = {\n")
+    for row in range(9):
+        values = ", ".join(f"0x{jump_directions(row * 9 + c):02x}" for c in range(9))
+        out.write(f"    {values},\n")
+    out.write("};\n\n")
 
-    mask = 0
-    for pos in ADJ_POSITIONS[i]:
-        mask |= 1 << pos
-    ADJ_POSITIONS[i] = mask
+    out.write("const uint64_t JUMP_LANDINGS[64] = {\n")
+    for i in range(0, 64, 4):
+        values = ", ".join(f"0x{jump_landings(i + j):010x}" for j in range(4))
+        out.write(f"    {values},\n")
+    out.write("};\n\n")
 
+    out.write("#endif  // _CONSTANTS_H\n")
 
-uint128array("ADJ_POSITIONS", ADJ_POSITIONS)
 
-print("const __uint128_t JUMP_POSITIONS[81][64] = {")
-for i in range(81):
-    print("{")
-    keys = sorted(JUMP_POSITIONS[i].keys())
-    for j in range(64):
-        if j not in keys:
-            print(hex128(0), end=",\n")
-        else:
-            print(hex128(JUMP_POSITIONS[i][j]), end=",\n")
-    print("},")
-print("};")
+if __name__ == "__main__":
+    if len(sys.argv) > 1:
+        with open(sys.argv[1], "w") as f:
+            main(f)
+    else:
+        main(sys.stdout)